@@ -0,0 +1,69 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Meta append-only vector
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+#include "Base.hpp"
+
+/**
+ * @brief AppendVector is an append-only vector whose elements never move
+ *
+ * Elements are stored in segments of growing size (each segment doubles the total capacity).
+ * A single writer may push elements while any number of readers access elements below 'size'.
+ */
+template<typename Type>
+class kF::Meta::Internal::AppendVector
+{
+public:
+    static_assert(std::is_trivially_copyable_v<Type> && std::is_trivially_destructible_v<Type>,
+        "AppendVector only supports trivial types");
+
+    /** @brief Index of an element */
+    using Index = std::uint32_t;
+
+    /** @brief Size of the first segment (must be a power of 2) */
+    static constexpr Index FirstSegmentSize = 16u;
+
+    /** @brief Maximum number of segments */
+    static constexpr Index SegmentCount = 28u;
+
+    /** @brief Default constructor */
+    AppendVector(void) noexcept = default;
+
+    /** @brief Destructor */
+    ~AppendVector(void) noexcept { clear(); }
+
+    /** @brief AppendVector is not copyable */
+    AppendVector(const AppendVector &other) = delete;
+    AppendVector &operator=(const AppendVector &other) = delete;
+
+    /** @brief Push an element (not thread safe against other writers) */
+    void push(const Type &value);
+
+    /** @brief Get an element, index must be lower than 'size' (thread safe) */
+    [[nodiscard]] const Type &operator[](const Index index) const noexcept;
+    [[nodiscard]] Type &operator[](const Index index) noexcept
+        { return const_cast<Type &>(std::as_const(*this)[index]); }
+
+    /** @brief Get the number of published elements (thread safe) */
+    [[nodiscard]] Index size(void) const noexcept { return _size.load(std::memory_order_acquire); }
+
+    /** @brief Check if the vector is empty (thread safe) */
+    [[nodiscard]] bool empty(void) const noexcept { return !size(); }
+
+    /** @brief Release every segment (not thread safe) */
+    void clear(void) noexcept;
+
+private:
+    std::atomic<Type *> _segments[SegmentCount] {};
+    std::atomic<Index> _size { 0u };
+
+    /** @brief Get the segment and the offset of an element */
+    [[nodiscard]] static std::pair<Index, Index> Locate(const Index index) noexcept;
+};
@@ -0,0 +1,50 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Meta append-only vector
+ */
+
+#include <bit>
+#include <new>
+
+template<typename Type>
+inline void kF::Meta::Internal::AppendVector<Type>::push(const Type &value)
+{
+    const auto size = _size.load(std::memory_order_relaxed);
+    const auto [segment, offset] = Locate(size);
+    auto data = _segments[segment].load(std::memory_order_relaxed);
+
+    if (!data) [[unlikely]] {
+        data = new Type[FirstSegmentSize << segment];
+        _segments[segment].store(data, std::memory_order_release);
+    }
+    data[offset] = value;
+    _size.store(size + 1u, std::memory_order_release);
+}
+
+template<typename Type>
+inline const Type &kF::Meta::Internal::AppendVector<Type>::operator[](const Index index) const noexcept
+{
+    const auto [segment, offset] = Locate(index);
+
+    return _segments[segment].load(std::memory_order_acquire)[offset];
+}
+
+template<typename Type>
+inline void kF::Meta::Internal::AppendVector<Type>::clear(void) noexcept
+{
+    for (auto &segment : _segments)
+        delete[] segment.exchange(nullptr, std::memory_order_acq_rel);
+    _size.store(0u, std::memory_order_release);
+}
+
+template<typename Type>
+inline std::pair<typename kF::Meta::Internal::AppendVector<Type>::Index, typename kF::Meta::Internal::AppendVector<Type>::Index>
+    kF::Meta::Internal::AppendVector<Type>::Locate(const Index index) noexcept
+{
+    constexpr Index FirstSegmentBits = std::bit_width(FirstSegmentSize) - 1u;
+
+    const auto shifted = index + FirstSegmentSize;
+    const auto segment = static_cast<Index>(std::bit_width(shifted)) - 1u - FirstSegmentBits;
+
+    return std::make_pair(segment, shifted - (FirstSegmentSize << segment));
+}
@@ -17,12 +17,27 @@
 #include <Kube/Core/Assert.hpp>
 #include <Kube/Core/Utils.hpp>
 
-#include "Forward.hpp"
-
+/** @brief Small optimization size and alignment of the default Var, 'BasicVar' may use others */
 #ifndef KF_META_VAR_SMALL_OPTIMIZATION_SIZE
 # define KF_META_VAR_SMALL_OPTIMIZATION_SIZE 16ul
 #endif
 
+#ifndef KF_META_VAR_SMALL_OPTIMIZATION_ALIGNMENT
+# define KF_META_VAR_SMALL_OPTIMIZATION_ALIGNMENT 16ul
+#endif
+
+/** @brief When enabled, heap stored values of the default Var are allocated from thread cached size class pools instead of the heap */
+#ifndef KF_META_VAR_POOL_ALLOCATOR
+# define KF_META_VAR_POOL_ALLOCATOR 0
+#endif
+
+#include "Forward.hpp"
+
+/** @brief When enabled, operator tables are only instantiated for types passed to 'Factory::Register' */
+#ifndef KF_META_COMPACT_DESCRIPTORS
+# define KF_META_COMPACT_DESCRIPTORS 0
+#endif
+
 namespace kF
 {
     namespace Meta
@@ -53,9 +68,20 @@ namespace kF
             Total
         };
 
+        /**
+         * @brief Tells if a type can be moved with a memcpy, the source being discarded without destruction
+         *
+         * Trivially copyable types are relocatable, other types (like owning pointers) may specialize this trait.
+         */
+        template<typename Type>
+        struct TriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<Type>> {};
+
         /** @brief Register all base metadata */
         void RegisterMetadata(void);
 
+        /** @brief Register all base metadata, sharding registered types across 'threadCount' threads */
+        void RegisterMetadata(const std::size_t threadCount);
+
         /**
          * @brief Internal type resolvers and helpers
          */
@@ -125,6 +151,10 @@ namespace kF
             template<typename FunctionType>
             using FunctionDecomposerHelper = decltype(ToFunctionDecomposer(std::declval<FunctionType>()));
 
+            /** @brief Get the offset of a non-virtual Base subobject inside Derived */
+            template<typename Derived, typename Base>
+            [[nodiscard]] std::ptrdiff_t BaseOffset(void) noexcept;
+
             /** @brief Opaque function type */
             using OpaqueFunction = const void *;
 
@@ -144,10 +174,11 @@ namespace kF
             [[nodiscard]] OpaqueFunction GetFunctionIdentifier(void) noexcept { return FunctionIdentifier<FunctionPtr>::Get(); }
 
             constexpr auto VarSmallOptimizationSize = KF_META_VAR_SMALL_OPTIMIZATION_SIZE;
+            constexpr auto VarSmallOptimizationAlignment = KF_META_VAR_SMALL_OPTIMIZATION_ALIGNMENT;
 
-            /** @brief Helper to know if a type is trivial or not */
-            template<typename Type>
-            constexpr bool IsVarSmallOptimized = ConstexprTernary((std::is_same_v<Type, void>), false, sizeof(Type) <= VarSmallOptimizationSize);
+            /** @brief Helper to know if a type is stored in the inline storage of a Var */
+            template<typename Type, std::size_t InlineSize = VarSmallOptimizationSize, std::size_t Alignment = VarSmallOptimizationAlignment>
+            constexpr bool IsVarSmallOptimized = ConstexprTernary((std::is_same_v<Type, void>), false, sizeof(Type) <= InlineSize && alignof(Type) <= Alignment);
 
             /** @brief Helpers to check if an operator is avaible on a Type */
             template<typename Type> using BoolOperatorCheck = decltype(std::declval<Type>().operator bool());
@@ -241,6 +272,10 @@ namespace kF
             template<typename ArgType, bool AllowImplicitMove>
             decltype(auto) ForwardArgument(Var *any);
 
+            /** @brief Helper used to forward an argument whose type exactly matches the expected one, following 'ForwardArgument' semantics */
+            template<typename ArgType>
+            decltype(auto) ForwardExactArgument(void *arg, const bool isMovable);
+
             /** @brief Meta function invoker
              * Will perform different semantics uppon function's arguments
              * RVakue - Perfect forwarding, will move anyway (even references) !
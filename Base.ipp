@@ -11,6 +11,20 @@ kF::Meta::Type kF::Meta::Internal::FunctionDecomposer<Return(Args...)>::ArgType(
     return (*array[index])();
 }
 
+template<typename Derived, typename Base>
+inline std::ptrdiff_t kF::Meta::Internal::BaseOffset(void) noexcept
+{
+    static_assert(std::is_base_of_v<Base, Derived>, "Meta::Internal::BaseOffset: Derived must inherit from Base");
+    static_assert(requires(Base *base) { static_cast<Derived *>(base); },
+        "Meta::Internal::BaseOffset: Base must be an unambiguous non-virtual base of Derived");
+
+    // Converting a pointer to a non-virtual base is a constant adjustment that never reads the instance,
+    // it is computed on suitably aligned storage as no instance of Derived may be constructible
+    alignas(Derived) std::byte storage[sizeof(Derived)];
+    const auto derived = reinterpret_cast<Derived *>(storage);
+    return reinterpret_cast<const std::byte *>(static_cast<Base *>(derived)) - storage;
+}
+
 template<typename Type>
 inline void kF::Meta::Internal::MakeDefaultConstructor(void *instance) noexcept_constructible(Type)
 {
@@ -58,13 +72,13 @@ inline kF::Var kF::Meta::Internal::MakeBinaryOperator(const void *data, const Va
 {
     // Pointer only accepts std::size_t
     if constexpr (std::is_pointer_v<Type>) {
-        if (var.isCastAble<std::size_t>()) [[likely]]
-            return Var::Emplace<Type>((*OperatorFunc)(*reinterpret_cast<const Type *>(data), var.as<std::size_t>()));
+        if (const auto operand = var.tryCast<std::size_t>(); operand) [[likely]]
+            return Var::Emplace<Type>((*OperatorFunc)(*reinterpret_cast<const Type *>(data), *operand));
         else [[unlikely]]
             return Var::Emplace<Type>((*OperatorFunc)(*reinterpret_cast<const Type *>(data), var.convertExplicit<std::size_t>()));
     // If both operands are compatible, forward them
-    } else if (var.isCastAble<Type>())
-        return Var::Emplace<Type>((*OperatorFunc)(*reinterpret_cast<const Type *>(data), var.as<Type>()));
+    } else if (const auto operand = var.tryCast<Type>(); operand)
+        return Var::Emplace<Type>((*OperatorFunc)(*reinterpret_cast<const Type *>(data), *operand));
     // If the type is either a float or NOT an integral, we can try to convert the opaque variable to Type without further check
     else if constexpr (std::is_floating_point_v<Type> || !std::is_integral_v<Type>) {
         return Var::Emplace<Type>((*OperatorFunc)(*reinterpret_cast<const Type *>(data), var.convertExplicit<Type>()));
@@ -100,13 +114,13 @@ inline void kF::Meta::Internal::MakeAssignmentOperator(void *data, const Var &va
 {
     // Pointer only accepts std::size_t
     if constexpr (std::is_pointer_v<Type>)
-        if (var.isCastAble<std::size_t>()) [[likely]]
-            return (*OperatorFunc)(*reinterpret_cast<Type *>(data), var.as<std::size_t>());
+        if (const auto operand = var.tryCast<std::size_t>(); operand) [[likely]]
+            return (*OperatorFunc)(*reinterpret_cast<Type *>(data), *operand);
         else [[unlikely]]
             return (*OperatorFunc)(*reinterpret_cast<Type *>(data), var.convertExplicit<std::size_t>());
     // If both operands are compatible, forward them
-    else if (var.isCastAble<Type>())
-        return (*OperatorFunc)(*reinterpret_cast<Type *>(data), var.as<Type>());
+    else if (const auto operand = var.tryCast<Type>(); operand)
+        return (*OperatorFunc)(*reinterpret_cast<Type *>(data), *operand);
     // If the type is either a float or NOT an integral, we can try to convert the opaque variable to Type without further check
     else if constexpr (std::is_floating_point_v<Type> || !std::is_integral_v<Type>)
         return (*OperatorFunc)(*reinterpret_cast<Type *>(data), var.convertExplicit<Type>());
@@ -142,6 +156,22 @@ inline void kF::Meta::Internal::MakeAssignmentOperator(void *data, const Var &va
         return (*OperatorFunc)(*reinterpret_cast<Type *>(data), var.convertExplicit<Type>());
 }
 
+template<typename ArgType>
+inline decltype(auto) kF::Meta::Internal::ForwardExactArgument(void *arg, [[maybe_unused]] const bool isMovable)
+{
+    using FlatArgType = std::remove_cvref_t<ArgType>;
+
+    auto &value = *reinterpret_cast<FlatArgType *>(arg);
+    if constexpr (std::is_lvalue_reference_v<ArgType>) { // ArgType: (const) Type & -> forward the reference
+        return static_cast<ArgType>(value);
+    } else if constexpr (std::is_copy_constructible_v<FlatArgType>) { // ArgType: Type (&&) -> move temporaries, copy others
+        if (isMovable)
+            return FlatArgType { std::move(value) };
+        return FlatArgType { value };
+    } else
+        return FlatArgType { std::move(value) };
+}
+
 template<typename ArgType, bool AllowImplicitMove>
 inline decltype(auto) kF::Meta::Internal::ForwardArgument(Var *any)
 {
@@ -167,20 +197,21 @@ inline decltype(auto) kF::Meta::Internal::ForwardArgument(Var *any)
                 return static_cast<FlatArgType &>(any->cast<FlatArgType>()); // Try to forward reference
             else { // ArgType: const Type & -> use converter if needed
                 if constexpr (AllowImplicitMove) {
-                    if (!any->isCastAble<FlatArgType>()) [[unlikely]] // Perfect match
-                        any->emplace<FlatArgType>(any->convertExplicit<FlatArgType>()); // Convert any to FlatArgType
+                    if (const auto ptr = any->tryCast<FlatArgType>(); ptr) [[likely]] // Perfect match
+                        return static_cast<const FlatArgType &>(*ptr); // Forward the reference
+                    any->emplace<FlatArgType>(any->convertExplicit<FlatArgType>()); // Convert any to FlatArgType
                     return static_cast<const FlatArgType &>(any->as<FlatArgType>()); // Forward the reference
                 } else {
                     return static_cast<const FlatArgType &>(any->cast<FlatArgType>()); // Cast any to FlatArgType
                 }
             }
         } else { // ArgType: Type
-            if (any->isCastAble<FlatArgType>()) [[likely]] { // Perfect match
+            if (const auto ptr = any->tryCast<FlatArgType>(); ptr) [[likely]] { // Perfect match
                 if constexpr (AllowImplicitMove) { // Implicit move allowed so temporary values can be moved instead of copied
                     if (const auto storage = any->storageType(); storage == Var::StorageType::Value || storage == Var::StorageType::ValueOptimized)
-                        return FlatArgType { std::move(any->as<FlatArgType>()) }; // Move the value
+                        return FlatArgType { std::move(*ptr) }; // Move the value
                 }
-                return FlatArgType { any->as<FlatArgType>() }; // Deep copy of the value (maybe costly)
+                return FlatArgType { *ptr }; // Deep copy of the value (maybe costly)
             } else [[unlikely]]
                 return FlatArgType { any->convertExplicit<FlatArgType>() }; // Call the converter
         }
@@ -4,7 +4,9 @@ get_filename_component(KubeMetaBenchmarksDir ${CMAKE_CURRENT_LIST_FILE} PATH)
 
 set(KubeMetaBenchmarksSources
     ${KubeMetaBenchmarksDir}/Main.cpp
+    ${KubeMetaBenchmarksDir}/bench_Resolver.cpp
     ${KubeMetaBenchmarksDir}/bench_Signal.cpp
+    ${KubeMetaBenchmarksDir}/bench_Type.cpp
     ${KubeMetaBenchmarksDir}/bench_Var.cpp
 )
 
@@ -0,0 +1,263 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Meta Resolver benchmark
+ */
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/Meta/Meta.hpp>
+#include <Kube/Meta/Registerer.hpp>
+
+using namespace kF;
+
+/** @brief Maximum number of distinct types that can be registered by benchmarks */
+constexpr std::size_t BenchTypeCount = 10000;
+
+/** @brief Dummy type used to fill the resolver */
+template<std::size_t Index>
+struct BenchType {};
+
+/** @brief Hashed name of a dummy type */
+[[nodiscard]] static constexpr HashedName BenchTypeName(const std::size_t index) noexcept
+    { return static_cast<HashedName>(index + 1); }
+
+template<std::size_t Index>
+static void RegisterBenchType(void)
+{
+    Meta::Factory<BenchType<Index>>::Register(BenchTypeName(Index));
+}
+
+template<std::size_t ...Indexes>
+[[nodiscard]] static constexpr auto MakeBenchTypeTable(std::index_sequence<Indexes...>) noexcept
+{
+    return std::array<void(*)(void), sizeof...(Indexes)> { &RegisterBenchType<Indexes>... };
+}
+
+/** @brief Register function of every dummy type */
+static constexpr auto BenchTypeTable = MakeBenchTypeTable(std::make_index_sequence<BenchTypeCount>());
+
+/** @brief Clear the resolver and register 'count' dummy types, returns their types in a shuffled order */
+static std::vector<Meta::Type> PrepareBenchTypes(const std::size_t count)
+{
+    std::vector<Meta::Type> types;
+
+    Meta::Resolver::Clear();
+    for (auto i = 0ul; i < count; ++i) {
+        BenchTypeTable[i]();
+        types.push_back(Meta::Resolver::FindType(BenchTypeName(i)));
+    }
+    std::shuffle(types.begin(), types.end(), std::mt19937(42));
+    return types;
+}
+
+static void ResolverFindTypeLinearScan(benchmark::State &state)
+{
+    const auto types = PrepareBenchTypes(static_cast<std::size_t>(state.range(0)));
+    Core::Vector<Meta::Type> registered;
+    std::vector<HashedName> names;
+    auto it = 0ul;
+
+    for (const auto type : types) {
+        registered.push(type);
+        names.push_back(type.name());
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(*std::find_if(registered.begin(), registered.end(), [name = names[it]](const auto type) { return type.name() == name; }));
+        if (++it == names.size())
+            it = 0ul;
+    }
+    Meta::Resolver::Clear();
+}
+BENCHMARK(ResolverFindTypeLinearScan)->RangeMultiplier(10)->Range(10, BenchTypeCount);
+
+static void ResolverFindTypeByName(benchmark::State &state)
+{
+    const auto types = PrepareBenchTypes(static_cast<std::size_t>(state.range(0)));
+    std::vector<HashedName> names;
+    auto it = 0ul;
+
+    for (const auto type : types)
+        names.push_back(type.name());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Meta::Resolver::FindType(names[it]));
+        if (++it == names.size())
+            it = 0ul;
+    }
+    Meta::Resolver::Clear();
+}
+BENCHMARK(ResolverFindTypeByName)->RangeMultiplier(10)->Range(10, BenchTypeCount);
+
+static void ResolverFindTypeByID(benchmark::State &state)
+{
+    const auto types = PrepareBenchTypes(static_cast<std::size_t>(state.range(0)));
+    std::vector<Meta::Type::TypeID> ids;
+    auto it = 0ul;
+
+    for (const auto type : types)
+        ids.push_back(type.typeID());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Meta::Resolver::FindType(ids[it]));
+        if (++it == ids.size())
+            it = 0ul;
+    }
+    Meta::Resolver::Clear();
+}
+BENCHMARK(ResolverFindTypeByID)->RangeMultiplier(10)->Range(10, BenchTypeCount);
+
+static void ResolverSealedFindTypeByName(benchmark::State &state)
+{
+    const auto types = PrepareBenchTypes(static_cast<std::size_t>(state.range(0)));
+    std::vector<HashedName> names;
+    auto it = 0ul;
+
+    Meta::Resolver::Seal();
+    for (const auto type : types)
+        names.push_back(type.name());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Meta::Resolver::FindType(names[it]));
+        if (++it == names.size())
+            it = 0ul;
+    }
+    Meta::Resolver::Clear();
+}
+BENCHMARK(ResolverSealedFindTypeByName)->RangeMultiplier(10)->Range(10, BenchTypeCount);
+
+static void ResolverSealedFindTypeByID(benchmark::State &state)
+{
+    const auto types = PrepareBenchTypes(static_cast<std::size_t>(state.range(0)));
+    std::vector<Meta::Type::TypeID> ids;
+    auto it = 0ul;
+
+    Meta::Resolver::Seal();
+    for (const auto type : types)
+        ids.push_back(type.typeID());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Meta::Resolver::FindType(ids[it]));
+        if (++it == ids.size())
+            it = 0ul;
+    }
+    Meta::Resolver::Clear();
+}
+BENCHMARK(ResolverSealedFindTypeByID)->RangeMultiplier(10)->Range(10, BenchTypeCount);
+
+/** @brief Hashed name of a dummy template */
+[[nodiscard]] static constexpr HashedName BenchTemplateName(const std::size_t index) noexcept
+    { return static_cast<HashedName>(BenchTypeCount + index + 1); }
+
+template<std::size_t Index>
+static void RegisterBenchSpecialization(const HashedName name)
+{
+    Meta::Factory<BenchType<Index>>::Register(name, BenchTypeName(Index));
+}
+
+template<std::size_t ...Indexes>
+[[nodiscard]] static constexpr auto MakeBenchSpecializationTable(std::index_sequence<Indexes...>) noexcept
+{
+    return std::array<void(*)(const HashedName), sizeof...(Indexes)> { &RegisterBenchSpecialization<Indexes>... };
+}
+
+/** @brief Register function of every dummy type as a template specialization */
+static constexpr auto BenchSpecializationTable = MakeBenchSpecializationTable(std::make_index_sequence<BenchTypeCount>());
+
+/** @brief Clear the resolver and register 'templateCount' templates of 'specializationCount' specializations, returns their names in a shuffled order */
+static std::vector<std::pair<HashedName, HashedName>> PrepareBenchSpecializations(const std::size_t templateCount, const std::size_t specializationCount)
+{
+    std::vector<std::pair<HashedName, HashedName>> names;
+
+    Meta::Resolver::Clear();
+    for (auto i = 0ul; i < templateCount; ++i) {
+        for (auto j = 0ul; j < specializationCount; ++j) {
+            const auto index = i * specializationCount + j;
+            BenchSpecializationTable[index](BenchTemplateName(i));
+            names.emplace_back(BenchTemplateName(i), BenchTypeName(index));
+        }
+    }
+    std::shuffle(names.begin(), names.end(), std::mt19937(42));
+    return names;
+}
+
+static void ResolverFindTemplateSpecialization(benchmark::State &state)
+{
+    const auto names = PrepareBenchSpecializations(static_cast<std::size_t>(state.range(0)), static_cast<std::size_t>(state.range(1)));
+    auto it = 0ul;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Meta::Resolver::FindTemplateSpecialization(names[it].first, names[it].second));
+        if (++it == names.size())
+            it = 0ul;
+    }
+    Meta::Resolver::Clear();
+}
+BENCHMARK(ResolverFindTemplateSpecialization)->ArgsProduct({ { 10, 100, 1000 }, { 10 } })->Args({ 10, 1000 })->Args({ 100, 100 });
+
+static void ResolverSealedFindTemplateSpecialization(benchmark::State &state)
+{
+    const auto names = PrepareBenchSpecializations(static_cast<std::size_t>(state.range(0)), static_cast<std::size_t>(state.range(1)));
+    auto it = 0ul;
+
+    Meta::Resolver::Seal();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Meta::Resolver::FindTemplateSpecialization(names[it].first, names[it].second));
+        if (++it == names.size())
+            it = 0ul;
+    }
+    Meta::Resolver::Clear();
+}
+BENCHMARK(ResolverSealedFindTemplateSpecialization)->ArgsProduct({ { 10, 100, 1000 }, { 10 } })->Args({ 10, 1000 })->Args({ 100, 100 });
+
+static void ResolverConcurrentFindType(benchmark::State &state)
+{
+    constexpr auto PreRegisteredCount = BenchTypeCount / 2;
+
+    // The first thread registers types while every other one resolves them
+    if (state.thread_index() == 0) {
+        PrepareBenchTypes(PreRegisteredCount);
+        auto next = PreRegisteredCount;
+        for (auto _ : state) {
+            if (next != BenchTypeCount)
+                BenchTypeTable[next++]();
+        }
+        state.counters["Registered"] = static_cast<double>(next - PreRegisteredCount);
+    } else {
+        auto it = static_cast<std::size_t>(state.thread_index()) * PreRegisteredCount / static_cast<std::size_t>(state.threads());
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Meta::Resolver::FindType(BenchTypeName(it)));
+            if (++it == BenchTypeCount)
+                it = 0ul;
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+    }
+    if (state.thread_index() == 0)
+        Meta::Resolver::Clear();
+}
+BENCHMARK(ResolverConcurrentFindType)->ThreadRange(2, 16)->UseRealTime();
+
+static void ResolverRegisterTypes(benchmark::State &state)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        Meta::Resolver::Clear();
+        state.ResumeTiming();
+        for (const auto func : BenchTypeTable)
+            func();
+    }
+    Meta::Resolver::Clear();
+}
+BENCHMARK(ResolverRegisterTypes)->Unit(benchmark::kMillisecond);
+
+static void ResolverRegisterTypesParallel(benchmark::State &state)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        Meta::Resolver::Clear();
+        state.ResumeTiming();
+        Meta::Registerer::RegisterParallel(BenchTypeTable.begin(), BenchTypeTable.end(), static_cast<std::size_t>(state.range(0)));
+    }
+    Meta::Resolver::Clear();
+}
+BENCHMARK(ResolverRegisterTypesParallel)->RangeMultiplier(2)->Range(1, 16)->Unit(benchmark::kMillisecond)->UseRealTime();
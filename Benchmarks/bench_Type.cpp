@@ -0,0 +1,228 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Meta Type benchmark
+ */
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/Meta/Meta.hpp>
+
+using namespace kF;
+
+/** @brief Depth of the benchmarked hierarchy */
+constexpr std::size_t HierarchyDepth = 6;
+
+/** @brief Single inheritance hierarchy where Level<N> derives from Level<N - 1> */
+template<std::size_t Depth>
+struct Level : Level<Depth - 1> { int value[Depth] {}; };
+
+template<>
+struct Level<0> { int value {}; };
+
+template<std::size_t ...Indexes>
+static void RegisterHierarchy(std::index_sequence<Indexes...>)
+{
+    // Descriptors are cleared first as a base can't be registered twice
+    (Meta::Factory<Level<Indexes>>::Resolve().clear(), ...);
+    (Meta::Factory<Level<Indexes + 1>>::template RegisterBase<Level<Indexes>>(), ...);
+}
+
+/** @brief Clear the resolver and register the whole hierarchy */
+static void PrepareHierarchy(void)
+{
+    Meta::Resolver::Clear();
+    Meta::Factory<Level<HierarchyDepth>>::Resolve().clear();
+    RegisterHierarchy(std::make_index_sequence<HierarchyDepth>());
+}
+
+static void TypeFindBaseRoot(benchmark::State &state)
+{
+    PrepareHierarchy();
+    const auto derived = Meta::Factory<Level<HierarchyDepth>>::Resolve();
+    const auto root = Meta::Factory<Level<0>>::Resolve();
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(derived.findBase(root));
+}
+BENCHMARK(TypeFindBaseRoot);
+
+static void TypeFindBaseMiss(benchmark::State &state)
+{
+    PrepareHierarchy();
+    const auto derived = Meta::Factory<Level<HierarchyDepth>>::Resolve();
+    const auto unrelated = Meta::Factory<int>::Resolve();
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(derived.findBase(unrelated));
+}
+BENCHMARK(TypeFindBaseMiss);
+
+static void TypeVarTryCastRoot(benchmark::State &state)
+{
+    PrepareHierarchy();
+    Level<HierarchyDepth> derived {};
+    Var var;
+
+    var.assign(derived);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(var.tryCast<Level<0>>());
+}
+BENCHMARK(TypeVarTryCastRoot);
+
+/** @brief Number of functions registered on each level of the member hierarchy */
+constexpr std::size_t MembersPerLevel = 16;
+
+/** @brief Number of levels of the member hierarchy */
+constexpr std::size_t MemberDepth = 4;
+
+/** @brief Single inheritance hierarchy holding 'MembersPerLevel' functions per level */
+template<std::size_t Depth>
+struct MemberLevel : MemberLevel<Depth - 1>
+{
+    template<std::size_t Index>
+    static std::size_t MemberFunction(void) { return Index; }
+};
+
+template<>
+struct MemberLevel<0>
+{
+    template<std::size_t Index>
+    static std::size_t MemberFunction(void) { return Index; }
+};
+
+template<std::size_t Depth, std::size_t ...Indexes>
+static void RegisterMemberLevel(std::index_sequence<Indexes...>)
+{
+    using Level = MemberLevel<Depth>;
+
+    (Meta::Factory<Level>::template RegisterFunction<&Level::template MemberFunction<Depth * MembersPerLevel + Indexes>>(
+        static_cast<HashedName>(Depth * MembersPerLevel + Indexes + 1)), ...);
+}
+
+template<std::size_t Depth>
+static void RegisterMemberBase(void)
+{
+    if constexpr (Depth != 0)
+        Meta::Factory<MemberLevel<Depth>>::template RegisterBase<MemberLevel<Depth - 1>>();
+}
+
+/** @brief Clear the member hierarchy then register its functions and bases */
+template<std::size_t ...Depths>
+static void RegisterMemberHierarchy(std::index_sequence<Depths...>)
+{
+    (Meta::Factory<MemberLevel<Depths>>::Resolve().clear(), ...);
+    (RegisterMemberLevel<Depths>(std::make_index_sequence<MembersPerLevel>()), ...);
+    (RegisterMemberBase<Depths>(), ...);
+}
+
+/** @brief Lookup every function of the hierarchy from its most derived type */
+static void TypeFindFunctionInherited(benchmark::State &state)
+{
+    RegisterMemberHierarchy(std::make_index_sequence<MemberDepth>());
+    const auto derived = Meta::Factory<MemberLevel<MemberDepth - 1>>::Resolve();
+
+    for (auto _ : state) {
+        for (auto i = 1u; i <= MemberDepth * MembersPerLevel; ++i)
+            benchmark::DoNotOptimize(derived.findFunction(static_cast<HashedName>(i)));
+    }
+}
+BENCHMARK(TypeFindFunctionInherited);
+
+static void TypeFindFunctionMiss(benchmark::State &state)
+{
+    RegisterMemberHierarchy(std::make_index_sequence<MemberDepth>());
+    const auto derived = Meta::Factory<MemberLevel<MemberDepth - 1>>::Resolve();
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(derived.findFunction(static_cast<HashedName>(MemberDepth * MembersPerLevel + 1)));
+}
+BENCHMARK(TypeFindFunctionMiss);
+
+/** @brief Lookup a single function of the hierarchy through a call site cache */
+static void TypeFunctionCacheHit(benchmark::State &state)
+{
+    RegisterMemberHierarchy(std::make_index_sequence<MemberDepth>());
+    const auto derived = Meta::Factory<MemberLevel<MemberDepth - 1>>::Resolve();
+    Meta::FunctionCache cache(static_cast<HashedName>(1));
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(cache.find(derived));
+}
+BENCHMARK(TypeFunctionCacheHit);
+
+static void TypeFindFunctionUncached(benchmark::State &state)
+{
+    RegisterMemberHierarchy(std::make_index_sequence<MemberDepth>());
+    const auto derived = Meta::Factory<MemberLevel<MemberDepth - 1>>::Resolve();
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(derived.findFunction(static_cast<HashedName>(1)));
+}
+BENCHMARK(TypeFindFunctionUncached);
+
+/** @brief Lookup every converter of a builtin type (dense conversion matrix) */
+static void TypeFindConverterBuiltin(benchmark::State &state)
+{
+    Meta::Resolver::Clear();
+    Meta::RegisterMetadata();
+    const auto from = Meta::Factory<double>::Resolve();
+    const Meta::Type targets[] {
+        Meta::Factory<bool>::Resolve(),
+        Meta::Factory<std::int16_t>::Resolve(),
+        Meta::Factory<std::int32_t>::Resolve(),
+        Meta::Factory<std::uint64_t>::Resolve(),
+        Meta::Factory<float>::Resolve(),
+        Meta::Factory<std::string>::Resolve()
+    };
+
+    for (auto _ : state) {
+        for (const auto to : targets)
+            benchmark::DoNotOptimize(from.findConverter(to));
+    }
+}
+BENCHMARK(TypeFindConverterBuiltin);
+
+/** @brief Number of user types registered by the converter benchmark */
+constexpr std::size_t ConverterTypeCount = 1000;
+
+/** @brief User type convertible to any other one */
+template<std::size_t Index>
+struct ConverterType
+{
+    template<std::size_t Other>
+    explicit operator ConverterType<Other>(void) const noexcept { return ConverterType<Other>(); }
+};
+
+template<std::size_t Index>
+static void RegisterConverterType(void)
+{
+    using Type = ConverterType<Index>;
+
+    Meta::Factory<Type>::Register(static_cast<HashedName>(Index + 1));
+    Meta::Factory<Type>::template RegisterConverter<ConverterType<(Index + 1) % ConverterTypeCount>>();
+    Meta::Factory<Type>::template RegisterConverter<ConverterType<(Index + 7) % ConverterTypeCount>>();
+}
+
+template<std::size_t ...Indexes>
+static void RegisterConverterTypes(std::index_sequence<Indexes...>)
+{
+    (RegisterConverterType<Indexes>(), ...);
+}
+
+/** @brief Lookup converters among 1000 user types (sparse conversion matrix) */
+static void TypeFindConverterUserTypes(benchmark::State &state)
+{
+    Meta::Resolver::Clear();
+    RegisterConverterTypes(std::make_index_sequence<ConverterTypeCount>());
+    const auto from = Meta::Factory<ConverterType<500>>::Resolve();
+    const auto hit = Meta::Factory<ConverterType<507>>::Resolve();
+    const auto miss = Meta::Factory<ConverterType<0>>::Resolve();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(from.findConverter(hit));
+        benchmark::DoNotOptimize(from.findConverter(miss));
+    }
+}
+BENCHMARK(TypeFindConverterUserTypes);
@@ -3,7 +3,11 @@
  * @ Description: Meta Signal benchmark
  */
 
+#include <array>
 #include <chrono>
+#include <memory_resource>
+#include <string>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
@@ -89,4 +93,233 @@ GENERATE_REFERENCED_BENCHMARKS(COPY_CONSTRUCT)
         benchmark::DoNotOptimize(Type(std::move(x))); \
     )
 
-GENERATE_REFERENCED_BENCHMARKS(MOVE_CONSTRUCT)
\ No newline at end of file
+GENERATE_REFERENCED_BENCHMARKS(MOVE_CONSTRUCT)
+
+/** @brief Type constructed through its meta constructor */
+struct ConstructBenchType
+{
+    ConstructBenchType(std::int64_t x_, const std::string &y_) : x(x_), y(y_) {}
+
+    std::int64_t x;
+    std::string y;
+};
+
+static void PrepareConstructBenchType(void)
+{
+    Meta::Resolver::Clear();
+    Meta::RegisterMetadata();
+    Meta::Factory<ConstructBenchType>::Register("ConstructBenchType"_hash);
+    Meta::Factory<ConstructBenchType>::RegisterConstructor<std::int64_t, const std::string &>();
+}
+
+static void ConstructCustomVarConstruct(benchmark::State &state)
+{
+    PrepareConstructBenchType();
+    const std::string y(ShortStringValue);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Var::Construct("ConstructBenchType"_hash, std::int64_t(42), y));
+}
+BENCHMARK(ConstructCustomVarConstruct);
+
+/** @brief Manual path: resolve the type and its constructor then invoke it */
+static void ConstructCustomConstructorInvoke(benchmark::State &state)
+{
+    PrepareConstructBenchType();
+    const std::string y(ShortStringValue);
+
+    for (auto _ : state) {
+        const auto type = Meta::Resolver::FindType("ConstructBenchType"_hash);
+        const auto ctor = type.findConstructor<std::int64_t, const std::string &>();
+        benchmark::DoNotOptimize(ctor.invoke(std::int64_t(42), y));
+    }
+}
+BENCHMARK(ConstructCustomConstructorInvoke);
+
+/** @brief Manual path with a constructor resolved ahead */
+static void ConstructCustomConstructorInvokeResolved(benchmark::State &state)
+{
+    PrepareConstructBenchType();
+    const std::string y(ShortStringValue);
+    const auto ctor = Meta::Factory<ConstructBenchType>::Resolve().findConstructor<std::int64_t, const std::string &>();
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(ctor.invoke(std::int64_t(42), y));
+}
+BENCHMARK(ConstructCustomConstructorInvokeResolved);
+
+GENERATE_EXPR_BENCHMARK(ConstructCustomReference,
+    benchmark::DoNotOptimize(ConstructBenchType(42, ShortStringValue));
+)
+
+/** @brief Number of distinct types stored in the heterogeneous Var array */
+constexpr std::size_t HeterogeneousTypeCount = 256;
+
+/** @brief Number of Var in the heterogeneous array */
+constexpr std::size_t HeterogeneousVarCount = 4096;
+
+/** @brief Distinct small optimized type, each one owns its own meta descriptor */
+template<std::size_t Index>
+struct HeterogeneousType
+{
+    std::uint32_t value[Index % 2 + 1] { Index };
+};
+
+template<std::size_t ...Indexes>
+[[nodiscard]] static constexpr auto MakeHeterogeneousEmplaceTable(std::index_sequence<Indexes...>) noexcept
+{
+    return std::array<void(*)(Var &), sizeof...(Indexes)> {
+        [](Var &var) { var.emplace<HeterogeneousType<Indexes>>(); }...
+    };
+}
+
+/** @brief Build, copy and destroy an array of Var holding many distinct types, each Var touching another descriptor */
+static void VarHeterogeneousArray(benchmark::State &state)
+{
+    constexpr auto EmplaceTable = MakeHeterogeneousEmplaceTable(std::make_index_sequence<HeterogeneousTypeCount>());
+
+    for (auto _ : state) {
+        std::vector<Var> vars(HeterogeneousVarCount);
+        for (auto i = 0u; i != HeterogeneousVarCount; ++i)
+            EmplaceTable[(i * 7u) % HeterogeneousTypeCount](vars[i]);
+        std::vector<Var> copies(vars);
+        benchmark::DoNotOptimize(copies.data());
+    }
+}
+BENCHMARK(VarHeterogeneousArray);
+
+/** @brief 24 bytes vector, too large for the default Var inline storage */
+struct BenchVec3d
+{
+    double x {}, y {}, z {};
+};
+
+/** @brief Emplace then copy a value into a BasicVar of given inline size */
+template<std::size_t InlineSize, typename Type>
+static void BasicVarConstructCopy(benchmark::State &state, const Type &value)
+{
+    for (auto _ : state) {
+        auto var = BasicVar<InlineSize>::template Emplace<Type>(value);
+        benchmark::DoNotOptimize(BasicVar<InlineSize>(var));
+    }
+}
+
+/** @brief Move a value from a BasicVar of given inline size into the default Var */
+template<std::size_t InlineSize, typename Type>
+static void BasicVarMoveToVar(benchmark::State &state, const Type &value)
+{
+    for (auto _ : state) {
+        auto var = BasicVar<InlineSize>::template Emplace<Type>(value);
+        benchmark::DoNotOptimize(Var(std::move(var)));
+    }
+}
+
+BENCHMARK_CAPTURE(BasicVarConstructCopy<16>, StdStringLong, std::string(LongStringValue));
+BENCHMARK_CAPTURE(BasicVarConstructCopy<32>, StdStringLong, std::string(LongStringValue));
+BENCHMARK_CAPTURE(BasicVarConstructCopy<64>, StdStringLong, std::string(LongStringValue));
+BENCHMARK_CAPTURE(BasicVarConstructCopy<16>, FlatStringLong, Core::FlatString(LongStringValue));
+BENCHMARK_CAPTURE(BasicVarConstructCopy<32>, FlatStringLong, Core::FlatString(LongStringValue));
+BENCHMARK_CAPTURE(BasicVarConstructCopy<64>, FlatStringLong, Core::FlatString(LongStringValue));
+BENCHMARK_CAPTURE(BasicVarConstructCopy<16>, Vec3d, BenchVec3d { 1.0, 2.0, 3.0 });
+BENCHMARK_CAPTURE(BasicVarConstructCopy<32>, Vec3d, BenchVec3d { 1.0, 2.0, 3.0 });
+BENCHMARK_CAPTURE(BasicVarConstructCopy<64>, Vec3d, BenchVec3d { 1.0, 2.0, 3.0 });
+BENCHMARK_CAPTURE(BasicVarMoveToVar<32>, StdStringLong, std::string(LongStringValue));
+BENCHMARK_CAPTURE(BasicVarMoveToVar<64>, Vec3d, BenchVec3d { 1.0, 2.0, 3.0 });
+
+/** @brief Plain structures stored on the heap by the default Var */
+template<std::size_t Size>
+struct BenchBlob
+{
+    std::byte data[Size] {};
+};
+
+/** @brief Construct and destroy a heap stored value with a given Var allocator */
+template<typename Allocator, typename Type>
+static void VarAllocatorConstructDestroy(benchmark::State &state, const Type &value)
+{
+    using AllocatorVar = BasicVar<kF::Var::SmallOptimizationSize, kF::Var::SmallOptimizationAlignment, Allocator>;
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(AllocatorVar::template Emplace<Type>(value));
+}
+
+#define GENERATE_VAR_ALLOCATOR_BENCHMARKS(Allocator) \
+    BENCHMARK_CAPTURE(VarAllocatorConstructDestroy<Meta::Allocator>, StdStringLong, std::string(LongStringValue))->Threads(1)->Threads(16); \
+    BENCHMARK_CAPTURE(VarAllocatorConstructDestroy<Meta::Allocator>, Blob64, BenchBlob<64> {})->Threads(1)->Threads(16); \
+    BENCHMARK_CAPTURE(VarAllocatorConstructDestroy<Meta::Allocator>, Blob256, BenchBlob<256> {})->Threads(1)->Threads(16);
+
+GENERATE_VAR_ALLOCATOR_BENCHMARKS(VarHeapAllocator)
+GENERATE_VAR_ALLOCATOR_BENCHMARKS(VarPoolAllocator)
+
+/** @brief Number of temporary Var created by a request */
+constexpr std::size_t RequestVarCount = 500;
+
+/** @brief Create and release the mixed temporary Vars of a request */
+template<typename Allocator>
+static void RunRequest(void)
+{
+    using AllocatorVar = BasicVar<kF::Var::SmallOptimizationSize, kF::Var::SmallOptimizationAlignment, Allocator>;
+
+    std::vector<AllocatorVar> vars(RequestVarCount);
+    for (auto i = 0u; i != RequestVarCount; ++i) {
+        switch (i % 4u) {
+        case 0u:
+            vars[i].template emplace<std::int64_t>(i);
+            break;
+        case 1u:
+            vars[i].template emplace<BenchVec3d>();
+            break;
+        case 2u:
+            vars[i].template emplace<BenchBlob<64>>();
+            break;
+        default:
+            vars[i].template emplace<std::string>(LongStringValue);
+            break;
+        }
+    }
+    benchmark::DoNotOptimize(vars.data());
+}
+
+template<typename Allocator>
+static void VarRequestWorkload(benchmark::State &state)
+{
+    for (auto _ : state)
+        RunRequest<Allocator>();
+}
+BENCHMARK(VarRequestWorkload<Meta::VarHeapAllocator>);
+BENCHMARK(VarRequestWorkload<Meta::VarPoolAllocator>);
+
+/** @brief Same workload drawing from a monotonic arena released at the end of the request */
+static void VarRequestWorkloadMonotonic(benchmark::State &state)
+{
+    std::vector<std::byte> buffer(64 * 1024);
+
+    for (auto _ : state) {
+        std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
+        Meta::VarMonotonicAllocator::Scope scope(arena);
+        RunRequest<Meta::VarMonotonicAllocator>();
+    }
+}
+BENCHMARK(VarRequestWorkloadMonotonic);
+
+/** @brief Reassign a long-lived Var slot with values of varying types every iteration */
+template<bool ReserveCapacity>
+static void VarSlotReassign(benchmark::State &state)
+{
+    using HeapVar = BasicVar<kF::Var::SmallOptimizationSize, kF::Var::SmallOptimizationAlignment, Meta::VarHeapAllocator>;
+
+    HeapVar slot;
+    const std::string str(ShortStringValue);
+
+    if constexpr (ReserveCapacity)
+        slot.reserveCapacity(sizeof(BenchBlob<64>));
+    for (auto _ : state) {
+        slot.emplace<BenchBlob<64>>();
+        slot.emplace<BenchVec3d>();
+        slot.emplace<std::int64_t>(42);
+        slot.emplace<std::string>(str);
+        benchmark::DoNotOptimize(slot.data());
+    }
+}
+BENCHMARK(VarSlotReassign<false>);
+BENCHMARK(VarSlotReassign<true>);
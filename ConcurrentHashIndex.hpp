@@ -0,0 +1,90 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Meta concurrent hash index
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "HashIndex.hpp"
+
+/**
+ * @brief ConcurrentHashIndex is a HashIndex that can be read while a single writer inserts into it
+ *
+ * Readers never block: positions are published atomically once their key is written.
+ * When the table grows, the writer builds a new table and swaps it atomically, previous tables are retired
+ * and only released by 'releaseRetired' or 'clear' (their total size is bounded by the size of the current table).
+ * Writers must be serialized externally.
+ */
+class kF::Meta::Internal::ConcurrentHashIndex
+{
+public:
+    /** @brief Key of an indexed element */
+    using Key = HashIndex::Key;
+
+    /** @brief Position of an indexed element in its external storage */
+    using Position = HashIndex::Position;
+
+    /** @brief Position returned when a key is not found (also used to mark empty buckets) */
+    static constexpr Position NullPosition = HashIndex::NullPosition;
+
+    /** @brief Minimum bucket count allocated on first insertion */
+    static constexpr Position MinBucketCount = HashIndex::MinBucketCount;
+
+    /** @brief An indexing slot, the key is only valid once the position is published */
+    struct Bucket
+    {
+        Key key {};
+        std::atomic<Position> position { NullPosition };
+    };
+
+    /** @brief A table of buckets */
+    struct Table
+    {
+        Position mask { 0u };
+        std::unique_ptr<Bucket[]> buckets {};
+        std::unique_ptr<Table> retired {};
+    };
+
+    /** @brief Default constructor */
+    ConcurrentHashIndex(void) noexcept = default;
+
+    /** @brief Destructor */
+    ~ConcurrentHashIndex(void) noexcept { clear(); }
+
+    /** @brief ConcurrentHashIndex is not copyable */
+    ConcurrentHashIndex(const ConcurrentHashIndex &other) = delete;
+    ConcurrentHashIndex &operator=(const ConcurrentHashIndex &other) = delete;
+
+    /** @brief Insert a position under a given key (not thread safe against other writers) */
+    void insert(const Key key, const Position position);
+
+    /** @brief Find the first position of a given key that satisfies a predicate (thread safe) */
+    template<typename Predicate>
+    [[nodiscard]] Position find(const Key key, Predicate &&predicate) const noexcept;
+
+    /** @brief Find the first position of a given key (thread safe) */
+    [[nodiscard]] Position find(const Key key) const noexcept
+        { return find(key, [](const Position) { return true; }); }
+
+    /** @brief Get the number of indexed positions */
+    [[nodiscard]] Position size(void) const noexcept { return _size.load(std::memory_order_acquire); }
+
+    /** @brief Release every retired table (not thread safe) */
+    void releaseRetired(void) noexcept;
+
+    /** @brief Clear the index (not thread safe) */
+    void clear(void) noexcept;
+
+private:
+    std::atomic<Table *> _table { nullptr };
+    std::atomic<Position> _size { 0u };
+
+    /** @brief Build a table of twice the bucket count, re-index every position and publish it */
+    void grow(void);
+
+    /** @brief Insert a position into a table without checking the load factor */
+    static void InsertUnsafe(Table &table, const Key key, const Position position) noexcept;
+};
@@ -0,0 +1,82 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Meta concurrent hash index
+ */
+
+#include <algorithm>
+
+inline void kF::Meta::Internal::ConcurrentHashIndex::insert(const Key key, const Position position)
+{
+    const auto size = _size.load(std::memory_order_relaxed);
+    const auto table = _table.load(std::memory_order_relaxed);
+
+    if (!table || (size + 1u) * 2u > table->mask + 1u) [[unlikely]]
+        grow();
+    InsertUnsafe(*_table.load(std::memory_order_relaxed), key, position);
+    _size.store(size + 1u, std::memory_order_release);
+}
+
+template<typename Predicate>
+inline kF::Meta::Internal::ConcurrentHashIndex::Position kF::Meta::Internal::ConcurrentHashIndex::find(const Key key, Predicate &&predicate) const noexcept
+{
+    const auto table = _table.load(std::memory_order_acquire);
+
+    if (!table) [[unlikely]]
+        return NullPosition;
+    for (auto index = static_cast<Position>(HashIndex::Mix(key)) & table->mask; ; index = (index + 1u) & table->mask) {
+        const auto &bucket = table->buckets[index];
+        const auto position = bucket.position.load(std::memory_order_acquire);
+        if (position == NullPosition)
+            return NullPosition;
+        else if (bucket.key == key && predicate(position)) [[likely]]
+            return position;
+    }
+}
+
+inline void kF::Meta::Internal::ConcurrentHashIndex::releaseRetired(void) noexcept
+{
+    if (const auto table = _table.load(std::memory_order_relaxed); table)
+        table->retired.reset();
+}
+
+inline void kF::Meta::Internal::ConcurrentHashIndex::clear(void) noexcept
+{
+    delete _table.exchange(nullptr, std::memory_order_acq_rel);
+    _size.store(0u, std::memory_order_release);
+}
+
+inline void kF::Meta::Internal::ConcurrentHashIndex::grow(void)
+{
+    // The live table is only adopted once the new one is built, so a failed allocation leaves the index untouched
+    const auto previous = _table.load(std::memory_order_relaxed);
+    const auto bucketCount = previous ? (previous->mask + 1u) * 2u : MinBucketCount;
+    auto table = std::make_unique<Table>();
+
+    table->mask = bucketCount - 1u;
+    table->buckets = std::make_unique<Bucket[]>(bucketCount);
+    if (previous) {
+        // Re-insert positions in their original order so that duplicated keys keep their priority
+        Core::Vector<HashIndex::Bucket> buckets;
+        for (auto i = 0u; i <= previous->mask; ++i) {
+            const auto &bucket = previous->buckets[i];
+            if (const auto position = bucket.position.load(std::memory_order_relaxed); position != NullPosition)
+                buckets.push(HashIndex::Bucket { bucket.key, position });
+        }
+        std::sort(buckets.begin(), buckets.end(), [](const auto &lhs, const auto &rhs) { return lhs.position < rhs.position; });
+        for (const auto &bucket : buckets)
+            InsertUnsafe(*table, bucket.key, bucket.position);
+    }
+    // Readers may still hold the previous table, it is kept alive until retired tables are released
+    table->retired = std::unique_ptr<Table>(previous);
+    _table.store(table.release(), std::memory_order_release);
+}
+
+inline void kF::Meta::Internal::ConcurrentHashIndex::InsertUnsafe(Table &table, const Key key, const Position position) noexcept
+{
+    auto index = static_cast<Position>(HashIndex::Mix(key)) & table.mask;
+
+    while (table.buckets[index].position.load(std::memory_order_relaxed) != NullPosition)
+        index = (index + 1u) & table.mask;
+    table.buckets[index].key = key;
+    table.buckets[index].position.store(position, std::memory_order_release);
+}
@@ -5,26 +5,34 @@
 
 #pragma once
 
+#include <memory>
+
+#include <Kube/Core/Vector.hpp>
+
 #include "Type.hpp"
+#include "AppendVector.hpp"
+#include "ConcurrentHashIndex.hpp"
 
 class kF::Meta::Constructor
 {
 public:
     using InvokeFunc = bool(*)(void *, Var *);
+    using InvokeExactFunc = void(*)(void *, void * const *, const std::uint64_t);
     using ArgTypeFunc = Type(*)(const std::size_t) noexcept;
 
-    struct alignas_half_cacheline Descriptor
+    struct alignas_cacheline Descriptor
     {
         const std::size_t argsCount;
         const ArgTypeFunc argTypeFunc;
         const Type type;
         const InvokeFunc invokeFunc;
+        const InvokeExactFunc invokeExactFunc;
 
         template<typename Type, typename ...Args> requires std::constructible_from<Type, Args...>
         [[nodiscard]] static Descriptor Construct(void) noexcept;
     };
 
-    static_assert_fit_half_cacheline(Descriptor);
+    static_assert_fit_cacheline(Descriptor);
 
     /** @brief Construct passing a descriptor instance */
     Constructor(const Descriptor *desc = nullptr) noexcept : _desc(desc) {}
@@ -59,6 +67,38 @@ public:
     template<typename ...Args>
     [[nodiscard]] bool invoke(void *instance, Args &&...args) const;
 
+    /**
+     * @brief Invoke a constructor on the given instance with arguments of exactly the expected types, without intermediate Var
+     *
+     * Each bit of 'movableArgs' tells if its argument can be moved from when taken by value or by rvalue reference, others are copied
+     */
+    void invokeExact(void *instance, void * const *args, const std::uint64_t movableArgs) const
+        { (*_desc->invokeExactFunc)(instance, args, movableArgs); }
+
 private:
     const Descriptor *_desc = nullptr;
+};
+
+struct kF::Meta::Type::ConstructorMatch
+{
+    Constructor constructor {}; // Null if no constructor accepts the argument types
+    bool isExact { false }; // True if every argument has the type expected by the constructor
+    const Converter *converters { nullptr }; // Converter of each argument (null if it has the expected type), only set by cached inexact matches
+};
+
+struct kF::Meta::Type::ConstructorMatches
+{
+    /** @brief A resolved match and the argument types it was resolved for */
+    struct Entry
+    {
+        ConstructorMatch match {};
+        std::uint32_t argsOffset { 0u }; // Position of the first argument type in 'argTypes'
+        std::uint32_t argsCount { 0u };
+    };
+
+    std::uint32_t generation { 0u }; // Value of 'ConstructorsGeneration' when the matches were resolved
+    Internal::AppendVector<Entry> entries {};
+    Internal::AppendVector<Type> argTypes {}; // Argument types of every entry, concatenated
+    Internal::ConcurrentHashIndex index {}; // Hash of argument types -> position in 'entries'
+    Core::Vector<std::unique_ptr<Converter[]>> converters {}; // Argument converters of inexact matches, only accessed by writers
 };
\ No newline at end of file
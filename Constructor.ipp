@@ -20,6 +20,11 @@ inline kF::Meta::Constructor::Descriptor kF::Meta::Constructor::Descriptor::Cons
         type: Factory<Type>::Resolve(),
         invokeFunc: [](void *instance, Var *args) -> bool {
             return Internal::Invoke<Type, Dispatch, true, Decomposer>(instance, args, Decomposer::IndexSequence).operator bool();
+        },
+        invokeExactFunc: [](void *instance, void * const *args, const std::uint64_t movableArgs) {
+            [instance, args, movableArgs]<std::size_t ...Indexes>(std::index_sequence<Indexes...>) {
+                new (instance) Type { Internal::ForwardExactArgument<Args>(args[Indexes], movableArgs & (1ull << Indexes))... };
+            }(std::index_sequence_for<Args...>());
         }
     };
 }
@@ -0,0 +1,123 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Meta conversion matrix
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include <Kube/Core/Vector.hpp>
+
+#include "Converter.hpp"
+#include "AppendVector.hpp"
+#include "HashIndex.hpp"
+#include "ConcurrentHashIndex.hpp"
+
+/**
+ * @brief ConversionMatrix maps (from, to) pairs of type ordinals to their converter
+ *
+ * Small registries use a dense (from x to) table, so a lookup is a single indexed load.
+ * Large registries use a compressed sparse row form, a lookup scans the converters of the source type.
+ * A table only indexes the direct converters of the types registered when it was built.
+ * Other pairs are resolved on their first lookup, by searching the shortest chain of direct converters,
+ * and their converter (or its absence) is cached by the table so next lookups don't search again.
+ * Readers never block: each build creates a new immutable table and publishes it atomically, previous tables are retired
+ * and only released by 'releaseRetired' or 'clear'. Composite converters are kept until 'clear' as converters may refer to them,
+ * a path resolved with a previous table is reused so rebuilding the matrix doesn't grow them.
+ * Writers must be serialized externally.
+ */
+class kF::Meta::Internal::ConversionMatrix
+{
+public:
+    /** @brief Index of a type inside the matrix (its ordinal) */
+    using Index = std::uint32_t;
+
+    /** @brief Maximum type count of the dense form */
+    static constexpr Index DenseLimit = 256u;
+
+    /** @brief A table of direct converters, only its cache of resolved pairs grows once published */
+    struct Table
+    {
+        Core::Vector<Converter> cells {}; // Dense: (from * typeCount + to) -> converter, sparse: converters sorted by row
+        Core::Vector<Index> columns {}; // Sparse only: target ordinal of each cell
+        Core::Vector<Index> rowOffsets {}; // Sparse only: source ordinal -> first cell of its row (typeCount + 1 entries)
+        Index typeCount { 0u };
+        std::uint32_t generation { 0u };
+        ConcurrentHashIndex resolvedIndex {}; // (from << 32 | to) -> position in 'resolved'
+        AppendVector<Converter> resolved {}; // Converters of the pairs resolved since the table was built
+        std::unique_ptr<Table> retired {};
+    };
+
+    /** @brief Default constructor */
+    ConversionMatrix(void) noexcept = default;
+
+    /** @brief Destructor */
+    ~ConversionMatrix(void) noexcept { clear(); }
+
+    /** @brief ConversionMatrix is not copyable */
+    ConversionMatrix(const ConversionMatrix &other) = delete;
+    ConversionMatrix &operator=(const ConversionMatrix &other) = delete;
+
+    /** @brief Build a table from every registered type indexed by ordinal and publish it (not thread safe against other writers) */
+    void build(const AppendVector<Type> &ordinals, const std::uint32_t generation);
+
+    /**
+     * @brief Find the converter of a pair of types, either direct or composite (thread safe)
+     *
+     * Returns false if the pair must be resolved: it has no direct converter indexed by the published table
+     * and wasn't resolved since the table was built
+     */
+    [[nodiscard]] bool find(const Type::Ordinal from, const Type::Ordinal to, Converter &converter) const noexcept;
+
+    /** @brief Resolve the converter of a pair of registered types and cache it into the published table (not thread safe against other writers) */
+    [[nodiscard]] Converter resolve(const Type from, const Type to);
+
+    /** @brief Get the converters generation the published table was built with, 0 if not built (thread safe) */
+    [[nodiscard]] std::uint32_t generation(void) const noexcept;
+
+    /** @brief Get the number of indexed types (thread safe) */
+    [[nodiscard]] Index typeCount(void) const noexcept;
+
+    /** @brief Check if the published table uses its dense form (thread safe) */
+    [[nodiscard]] bool isDense(void) const noexcept;
+
+    /** @brief Release every retired table, must not run concurrently with any other function */
+    void releaseRetired(void) noexcept;
+
+    /** @brief Clear the matrix and its composite converters, must not run concurrently with any other function */
+    void clear(void) noexcept;
+
+private:
+    /** @brief A type reached by a path search */
+    struct PathNode
+    {
+        Type type {};
+        Index parent { 0u }; // Position of the previous type of the path
+        Converter edge {}; // Converter from the previous type
+    };
+
+    std::atomic<Table *> _table { nullptr };
+    HashIndex _compositeIndex {}; // (from << 32 | to) -> position in '_composites'
+    Core::Vector<std::unique_ptr<Converter::CompositeDescriptor>> _composites {};
+
+    /** @brief Release a table and every table it retired */
+    static void ReleaseChain(std::unique_ptr<Table> &&table) noexcept;
+
+    /** @brief Get the key of a pair of types */
+    [[nodiscard]] static HashIndex::Key MakeKey(const Type::Ordinal from, const Type::Ordinal to) noexcept
+        { return static_cast<HashIndex::Key>(from) << 32u | static_cast<Index>(to); }
+
+    /** @brief Search the shortest chain of at most 'MaxPathLength' direct converters between two types */
+    [[nodiscard]] Converter searchPath(const Type from, const Type to);
+
+    /** @brief Get the composite converter of a path, it is reused if it was already resolved */
+    [[nodiscard]] Converter makeComposite(const Type from, const Type to, const Converter *path, const std::uint32_t length);
+
+    /** @brief Fill a dense table */
+    static void BuildDense(Table &table, const AppendVector<Type> &ordinals);
+
+    /** @brief Fill a sparse table */
+    static void BuildSparse(Table &table, const AppendVector<Type> &ordinals);
+};
\ No newline at end of file
@@ -0,0 +1,208 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Meta conversion matrix
+ */
+
+#include <algorithm>
+
+inline void kF::Meta::Internal::ConversionMatrix::build(const AppendVector<Type> &ordinals, const std::uint32_t generation)
+{
+    auto table = std::make_unique<Table>();
+
+    table->typeCount = ordinals.size();
+    table->generation = generation;
+    if (table->typeCount <= DenseLimit)
+        BuildDense(*table, ordinals);
+    else
+        BuildSparse(*table, ordinals);
+    // Readers may still hold the previous table, it is kept alive until retired tables are released
+    table->retired = std::unique_ptr<Table>(_table.load(std::memory_order_relaxed));
+    _table.store(table.release(), std::memory_order_release);
+}
+
+inline bool kF::Meta::Internal::ConversionMatrix::find(const Type::Ordinal from, const Type::Ordinal to, Converter &converter) const noexcept
+{
+    const auto table = _table.load(std::memory_order_acquire);
+    const auto row = static_cast<Index>(from);
+    const auto column = static_cast<Index>(to);
+
+    if (!table) [[unlikely]]
+        return false;
+    // Ordinal::Null is always out of range
+    else if (row < table->typeCount && column < table->typeCount) [[likely]] {
+        if (table->rowOffsets.empty()) [[likely]]
+            converter = table->cells[row * table->typeCount + column];
+        else {
+            converter = Converter();
+            for (auto i = table->rowOffsets[row], end = table->rowOffsets[row + 1]; i != end; ++i) {
+                if (table->columns[i] == column) {
+                    converter = table->cells[i];
+                    break;
+                }
+            }
+        }
+        if (converter) [[likely]]
+            return true;
+    }
+    // Pairs without indexed direct converter are cached once resolved
+    const auto position = table->resolvedIndex.find(MakeKey(from, to));
+    if (position == ConcurrentHashIndex::NullPosition)
+        return false;
+    converter = table->resolved[position];
+    return true;
+}
+
+inline kF::Meta::Converter kF::Meta::Internal::ConversionMatrix::resolve(const Type from, const Type to)
+{
+    const auto table = _table.load(std::memory_order_relaxed);
+
+    if (!table || !from || !to || from.ordinal() == Type::Ordinal::Null || to.ordinal() == Type::Ordinal::Null) [[unlikely]]
+        return Converter();
+    const auto key = MakeKey(from.ordinal(), to.ordinal());
+    // Another writer may have resolved the pair since the lookup missed
+    if (const auto position = table->resolvedIndex.find(key); position != ConcurrentHashIndex::NullPosition)
+        return table->resolved[position];
+    const auto converter = searchPath(from, to);
+
+    // The converter must be published before being indexed
+    table->resolved.push(converter);
+    table->resolvedIndex.insert(key, table->resolved.size() - 1u);
+    return converter;
+}
+
+inline std::uint32_t kF::Meta::Internal::ConversionMatrix::generation(void) const noexcept
+{
+    const auto table = _table.load(std::memory_order_acquire);
+
+    return table ? table->generation : 0u;
+}
+
+inline kF::Meta::Internal::ConversionMatrix::Index kF::Meta::Internal::ConversionMatrix::typeCount(void) const noexcept
+{
+    const auto table = _table.load(std::memory_order_acquire);
+
+    return table ? table->typeCount : 0u;
+}
+
+inline bool kF::Meta::Internal::ConversionMatrix::isDense(void) const noexcept
+{
+    const auto table = _table.load(std::memory_order_acquire);
+
+    return !table || table->rowOffsets.empty();
+}
+
+inline void kF::Meta::Internal::ConversionMatrix::releaseRetired(void) noexcept
+{
+    if (const auto table = _table.load(std::memory_order_relaxed); table)
+        ReleaseChain(std::move(table->retired));
+}
+
+inline void kF::Meta::Internal::ConversionMatrix::clear(void) noexcept
+{
+    ReleaseChain(std::unique_ptr<Table>(_table.exchange(nullptr, std::memory_order_acq_rel)));
+    _compositeIndex.clear();
+    _composites.clear();
+}
+
+inline void kF::Meta::Internal::ConversionMatrix::ReleaseChain(std::unique_ptr<Table> &&table) noexcept
+{
+    // Each table is detached from the chain before being released, so a long chain doesn't recurse
+    for (auto current = std::move(table); current; )
+        current = std::move(current->retired);
+}
+
+inline kF::Meta::Converter kF::Meta::Internal::ConversionMatrix::searchPath(const Type from, const Type to)
+{
+    Core::Vector<PathNode> nodes;
+    HashIndex reached; // TypeID hash -> position in 'nodes'
+    std::uint32_t depth = 0u;
+
+    // A type is never converted to itself through other types
+    if (from == to) [[unlikely]]
+        return Converter();
+    nodes.push(PathNode { .type = from });
+    reached.insert(from.typeID().hash_code(), 0u);
+    // Breadth first search over direct converters, the first path found to a type has the fewest conversions
+    // When a type has several converters to the same type, the first registered one wins as a linear scan would do
+    for (Index begin = 0u; begin != nodes.size() && depth != Converter::MaxPathLength; ++depth) {
+        for (const auto end = static_cast<Index>(nodes.size()); begin != end; ++begin) {
+            const auto cold = nodes[begin].type.findCold();
+            if (!cold)
+                continue;
+            for (const auto converter : cold->converters) {
+                const auto next = converter.convertType();
+                if (next == to) {
+                    Converter path[Converter::MaxPathLength] {};
+                    path[depth] = converter;
+                    for (auto current = begin, i = depth; i; current = nodes[current].parent)
+                        path[--i] = nodes[current].edge;
+                    return depth ? makeComposite(from, to, path, depth + 1u) : converter;
+                }
+                const auto key = next.typeID().hash_code();
+                if (reached.find(key, [&nodes, next](const auto position) { return nodes[position].type == next; }) != HashIndex::NullPosition)
+                    continue;
+                reached.insert(key, static_cast<HashIndex::Position>(nodes.size()));
+                nodes.push(PathNode { .type = next, .parent = begin, .edge = converter });
+            }
+        }
+    }
+    return Converter();
+}
+
+inline kF::Meta::Converter kF::Meta::Internal::ConversionMatrix::makeComposite(const Type from, const Type to, const Converter *path, const std::uint32_t length)
+{
+    const auto key = MakeKey(from.ordinal(), to.ordinal());
+    const auto position = _compositeIndex.find(key, [this, path, length](const auto position) {
+        const auto &composite = *_composites[position];
+        return composite.length == length && std::equal(path, path + length, composite.path);
+    });
+    if (position != HashIndex::NullPosition) [[likely]]
+        return Converter(_composites[position].get());
+
+    auto composite = std::make_unique<Converter::CompositeDescriptor>(Converter::CompositeDescriptor {
+        .descriptor = Converter::Descriptor {
+            .convertType = to,
+            .convertFunc = nullptr
+        },
+        .length = length
+    });
+    std::copy(path, path + length, composite->path);
+    _compositeIndex.insert(key, static_cast<HashIndex::Position>(_composites.size()));
+    _composites.push(std::move(composite));
+    return Converter(_composites[_composites.size() - 1u].get());
+}
+
+inline void kF::Meta::Internal::ConversionMatrix::BuildDense(Table &table, const AppendVector<Type> &ordinals)
+{
+    table.cells = Core::Vector<Converter>(table.typeCount * table.typeCount);
+    for (Index row = 0u; row != table.typeCount; ++row) {
+        const auto cold = ordinals[row].findCold();
+        if (!cold)
+            continue;
+        // When a type has several converters to the same type, the first registered one wins as a linear scan would do
+        for (const auto converter : cold->converters) {
+            const auto column = static_cast<Index>(converter.convertType().ordinal());
+            if (column < table.typeCount && !table.cells[row * table.typeCount + column])
+                table.cells[row * table.typeCount + column] = converter;
+        }
+    }
+}
+
+inline void kF::Meta::Internal::ConversionMatrix::BuildSparse(Table &table, const AppendVector<Type> &ordinals)
+{
+    table.rowOffsets = Core::Vector<Index>(table.typeCount + 1u);
+    for (Index row = 0u; row != table.typeCount; ++row) {
+        table.rowOffsets[row] = static_cast<Index>(table.cells.size());
+        const auto cold = ordinals[row].findCold();
+        if (!cold)
+            continue;
+        // Cells keep the registration order, lookups return the first converter of a column
+        for (const auto converter : cold->converters) {
+            if (const auto column = static_cast<Index>(converter.convertType().ordinal()); column < table.typeCount) {
+                table.columns.push(column);
+                table.cells.push(converter);
+            }
+        }
+    }
+    table.rowOffsets[table.typeCount] = static_cast<Index>(table.cells.size());
+}
\ No newline at end of file
@@ -28,9 +28,18 @@ public:
 
     static_assert_fit_quarter_cacheline(Descriptor);
 
+    /** @brief Maximum number of direct converters chained by a composite converter */
+    static constexpr std::uint32_t MaxPathLength = 4u;
+
+    /** @brief Describe a composite converter, chaining direct converters through intermediate types */
+    struct CompositeDescriptor;
+
     /** @brief Construct passing a descriptor instance */
     Converter(const Descriptor *desc = nullptr) noexcept : _desc(desc) {}
 
+    /** @brief Construct passing a composite descriptor instance */
+    Converter(const CompositeDescriptor *composite) noexcept;
+
     /** @brief Copy constructor */
     Converter(const Converter &other) noexcept = default;
 
@@ -47,14 +56,27 @@ public:
     /** @brief Get target converter type */
     [[nodiscard]] Type convertType(void) const noexcept { return _desc->convertType; }
 
+    /** @brief Check if the converter chains several direct converters */
+    [[nodiscard]] bool isComposite(void) const noexcept { return !_desc->convertFunc; }
+
     /** @brief Invoke the converter and return a Var */
     [[nodiscard]] Var invoke(const Var &from) const { Var to; invoke<Var::ShouldDestructInstance::No>(from, to); return to; }
 
     /** @brief Invoke the converter directly to a Var */
     template<Var::ShouldDestructInstance DestructInstance = Var::ShouldDestructInstance::Yes>
     void invoke(const Var &from, Var &to) const;
-    void invoke(const void *from, void *to) const { (*_desc->convertFunc)(from, to); }
+    void invoke(const void *from, void *to) const;
 
 private:
     const Descriptor *_desc = nullptr;
+
+    /** @brief Invoke each converter of a composite path, intermediate values are stored on the stack when possible */
+    void invokeComposite(const void *from, void *to) const;
+};
+
+struct kF::Meta::Converter::CompositeDescriptor
+{
+    Descriptor descriptor; // Its 'convertFunc' is null, which identifies a composite converter
+    std::uint32_t length { 0u };
+    Converter path[MaxPathLength] {};
 };
\ No newline at end of file
@@ -3,6 +3,9 @@
  * @ Description: Meta Converter
  */
 
+#include <cstddef>
+#include <new>
+
 template<typename From, typename To, auto FunctionPtr>
 inline kF::Meta::Converter::Descriptor kF::Meta::Converter::Descriptor::Construct(void) noexcept
 {
@@ -35,14 +38,76 @@ inline kF::Meta::Converter::Descriptor kF::Meta::Converter::Descriptor::Construc
     };
 }
 
+inline kF::Meta::Converter::Converter(const CompositeDescriptor *composite) noexcept
+    : _desc(&composite->descriptor)
+{
+}
+
+inline void kF::Meta::Converter::invoke(const void *from, void *to) const
+{
+    if (_desc->convertFunc) [[likely]]
+        (*_desc->convertFunc)(from, to);
+    else
+        invokeComposite(from, to);
+}
+
+inline void kF::Meta::Converter::invokeComposite(const void *from, void *to) const
+{
+    constexpr std::size_t BufferSize = Core::CacheLineSize;
+
+    /** @brief Intermediate converted value, destroyed once the next step is done */
+    struct Intermediate
+    {
+        Type type {};
+        void *data { nullptr };
+        bool isAllocated { false };
+
+        ~Intermediate(void) { release(); }
+
+        void release(void)
+        {
+            if (!data)
+                return;
+            type.destruct(data);
+            if (isAllocated)
+                ::operator delete(data, std::align_val_t(type.typeAlignment()));
+            data = nullptr;
+        }
+    };
+
+    // 'descriptor' is the first member of its standard-layout composite
+    const auto &composite = *reinterpret_cast<const CompositeDescriptor *>(_desc);
+    alignas(std::max_align_t) std::byte buffers[2][BufferSize];
+    Intermediate intermediates[2] {};
+    const void *input = from;
+
+    for (auto i = 0u; i != composite.length - 1u; ++i) {
+        auto &intermediate = intermediates[i % 2u];
+        const auto type = composite.path[i].convertType();
+        const bool fits = type.typeSize() <= BufferSize && type.typeAlignment() <= alignof(std::max_align_t);
+        void *output = fits ? static_cast<void *>(buffers[i % 2u]) : ::operator new(type.typeSize(), std::align_val_t(type.typeAlignment()));
+
+        try {
+            composite.path[i].invoke(input, output);
+        } catch (...) {
+            if (!fits)
+                ::operator delete(output, std::align_val_t(type.typeAlignment()));
+            throw;
+        }
+        intermediate.type = type;
+        intermediate.data = output;
+        intermediate.isAllocated = !fits;
+        input = output;
+        // The previous intermediate is not needed anymore
+        intermediates[(i + 1u) % 2u].release();
+    }
+    composite.path[composite.length - 1u].invoke(input, to);
+}
+
 template<kF::Var::ShouldDestructInstance DestructInstance>
 void kF::Meta::Converter::invoke(const Var &from, Var &to) const
 {
-    if (auto type = convertType(); type.isSmallOptimized()) {
-        to.reserve<Var::UseSmallOptimization::Yes, DestructInstance>(type);
-        invoke(from.data(), to.data<Var::UseSmallOptimization::Yes>());
-    } else {
-        to.reserve<Var::UseSmallOptimization::No, DestructInstance>(type);
-        invoke(from.data(), to.data<Var::UseSmallOptimization::No>());
-    }
+    // The destination may store the value in its reused heap block
+    to.reserve<DestructInstance>(convertType());
+    invoke(from.data(), to.data());
 }
\ No newline at end of file
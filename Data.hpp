@@ -5,8 +5,6 @@
 
 #pragma once
 
-#include <Kube/Core/TrivialFunctor.hpp>
-
 #include "Type.hpp"
 #include "Signal.hpp"
 
@@ -16,9 +14,9 @@
 class kF::Meta::Data
 {
 public:
-    using GetFunc = Core::TrivialFunctor<Var(const void *)>;
-    using SetCopyFunc = Core::TrivialFunctor<Var(const void *, const Var &)>;
-    using SetMoveFunc = Core::TrivialFunctor<Var(const void *, Var &&)>;
+    using GetFunc = Var(*)(const void *);
+    using SetCopyFunc = Var(*)(const void *, const Var &);
+    using SetMoveFunc = Var(*)(const void *, Var &&);
 
     /** @brief Describe a meta data */
     struct alignas_cacheline Descriptor
@@ -26,6 +24,7 @@ public:
         const HashedName name {};
         const bool isStatic {};
         const Type type {};
+        const Type ownerType {};
         const GetFunc getFunc {};
         const SetCopyFunc setCopyFunc {};
         const SetMoveFunc setMoveFunc {};
@@ -72,14 +71,17 @@ public:
     /** @brief Get underlying data type */
     [[nodiscard]] Type type(void) const noexcept { return _desc->type; }
 
+    /** @brief Retreive the type that registered the data */
+    [[nodiscard]] Type ownerType(void) const noexcept { return _desc->ownerType; }
+
 
-    /** @brief Get the underlying instance */
-    [[nodiscard]] Var get(const Var &instance) const { return _desc->getFunc(instance.data()); }
+    /** @brief Get the underlying instance, the instance is adjusted if the data belongs to one of its bases */
+    [[nodiscard]] Var get(const Var &instance) const { return _desc->getFunc(adjustInstance(instance)); }
     [[nodiscard]] Var get(const void *instance = nullptr) const { return _desc->getFunc(instance); }
 
-    /** @brief Call member setter using a opaque variable */
+    /** @brief Call member setter using a opaque variable, the instance is adjusted if the data belongs to one of its bases */
     template<typename Type>
-    [[nodiscard]] Var set(const Var &instance, Type &&value) const { return set(instance.data(), std::forward<Type>(value)); }
+    [[nodiscard]] Var set(const Var &instance, Type &&value) const { return set(adjustInstance(instance), std::forward<Type>(value)); }
 
     /** @brief Call member setter using a opaque pointer */
     template<typename Type>
@@ -91,4 +93,7 @@ public:
 
 private:
     const Descriptor *_desc = nullptr;
+
+    /** @brief Adjust an instance to the type that registered the data (nullptr if the data is static) */
+    [[nodiscard]] const void *adjustInstance(const Var &instance) const;
 };
\ No newline at end of file
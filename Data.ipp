@@ -34,6 +34,7 @@ inline kF::Meta::Data::Descriptor kF::Meta::Data::Descriptor::Construct(const Ha
         name: name,
         isStatic: GetDecomposer::IsFunctor || !GetDecomposer::IsMember,
         type: Factory<typename GetDecomposer::ReturnType>::Resolve(),
+        ownerType: Factory<Type>::Resolve(),
         getFunc: [](const void *instance) -> Var {
             if constexpr (GetDecomposer::IsFunctor)
                 return Var::Assign(GetFunctionPtr());
@@ -85,4 +86,15 @@ inline kF::Var kF::Meta::Data::set(const void *instance, Type &&value) const
         }
         return _desc->setCopyFunc(instance, kF::Var::Assign(std::forward<Type>(value)));
     }
+}
+
+inline const void *kF::Meta::Data::adjustInstance(const Var &instance) const
+{
+    if (isStatic())
+        return nullptr;
+    const auto adjusted = instance.type().upcast(ownerType(), instance.data());
+
+    kFAssert(adjusted,
+        throw std::runtime_error("Meta::Data: Instance type is not related to the type that registered the data"));
+    return adjusted;
 }
\ No newline at end of file
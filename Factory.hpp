@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "Type.hpp"
 
 /**
@@ -14,6 +16,13 @@ template<typename RegisteredType>
 class kF::Meta::FactoryBase
 {
 public:
+    /**
+     * @brief Collect members of templated type and register them in a single batch
+     *
+     * Each member list is checked for duplicates once and grown with a single exact-size allocation at commit.
+     */
+    class Builder;
+
     /** @brief Resolve the templated type's meta descriptor */
     [[nodiscard]] static Type Resolve(void) noexcept
         { return Type(&_Descriptor); }
@@ -38,15 +47,15 @@ public:
     template<typename To, auto FunctionPtr = nullptr>
     static Converter RegisterConverter(void) noexcept_ndebug;
 
-    /** @brief Register a function of templated type */
+    /** @brief Register a function of templated type, its name must not be used by another function of the type or of its bases */
     template<auto FunctionPtr>
     static Function RegisterFunction(const HashedName name) noexcept_ndebug;
 
-    /** @brief Register a data of templated type with a single setter */
+    /** @brief Register a data of templated type with a single setter, its name must not be used by another data of the type or of its bases */
     template<auto GetFunctionPtr, auto SetFunctionPtr>
     static Data RegisterData(const HashedName name) noexcept_ndebug;
 
-    /** @brief Register a data of templated type with a copy and a move setter */
+    /** @brief Register a data of templated type with a copy and a move setter, its name must not be used by another data of the type or of its bases */
     template<auto GetFunctionPtr, auto SetCopyFunctionPtr, auto SetMoveFunctionPtr>
     static Data RegisterData(const HashedName name) noexcept_ndebug;
 
@@ -60,6 +69,9 @@ public:
     template<auto SignalPtr>
     static Signal RegisterSignal(const HashedName name) noexcept_ndebug;
 
+    /** @brief Create a builder registering members of templated type in a single batch */
+    [[nodiscard]] static Builder Batch(void) noexcept { return Builder(); }
+
 
     /** @brief Default construct */
     FactoryBase(void) noexcept = default;
@@ -122,5 +134,89 @@ public:
 
 private:
     /** @brief Static helper used to store the descriptor instance of the templated type */
-    static inline Type::Descriptor _Descriptor { Type::Descriptor::Construct<RegisteredType>() };
+    static constinit inline Type::Descriptor _Descriptor { Type::Descriptor::Construct<RegisteredType>() };
+
+    /** @brief Split a single data setter into a copy and a move setter */
+    template<auto SetFunctionPtr>
+    struct DataSetters;
+
+    /** @brief Instantiate member descriptors without registering them */
+    template<typename ...Args>
+    [[nodiscard]] static Constructor MakeConstructor(void) noexcept;
+    template<typename To, auto FunctionPtr>
+    [[nodiscard]] static Converter MakeConverter(void) noexcept;
+    template<auto FunctionPtr>
+    [[nodiscard]] static Function MakeFunction(const HashedName name) noexcept;
+    template<auto GetFunctionPtr, auto SetCopyFunctionPtr, auto SetMoveFunctionPtr>
+    [[nodiscard]] static Data MakeData(const HashedName name) noexcept;
+    template<auto SignalPtr>
+    [[nodiscard]] static Signal MakeSignal(const HashedName name) noexcept;
+};
+
+template<typename RegisteredType>
+class kF::Meta::FactoryBase<RegisteredType>::Builder
+{
+public:
+    /** @brief Default constructor */
+    Builder(void) noexcept = default;
+
+    /** @brief Builder is movable only */
+    Builder(const Builder &other) = delete;
+    Builder(Builder &&other) noexcept = default;
+    Builder &operator=(const Builder &other) = delete;
+    Builder &operator=(Builder &&other) noexcept = default;
+
+    /** @brief Collect a base of templated type */
+    template<typename Base>
+    Builder &base(void)
+        { _bases.emplace_back(FactoryBase<Base>::Resolve(), Internal::BaseOffset<RegisteredType, Base>()); return *this; }
+
+    /** @brief Collect a custom constructor (not a default / copy / move constructor) */
+    template<typename ...Args>
+    Builder &constructor(void)
+        { _constructors.push_back(MakeConstructor<Args...>()); return *this; }
+
+    /** @brief Collect a converter of templated type */
+    template<typename To, auto FunctionPtr = nullptr>
+    Builder &converter(void)
+        { _converters.push_back(MakeConverter<To, FunctionPtr>()); return *this; }
+
+    /** @brief Collect a function of templated type */
+    template<auto FunctionPtr>
+    Builder &function(const HashedName name)
+        { _functions.push_back(MakeFunction<FunctionPtr>(name)); return *this; }
+
+    /** @brief Collect a data of templated type with a single setter */
+    template<auto GetFunctionPtr, auto SetFunctionPtr>
+    Builder &data(const HashedName name)
+        { return data<GetFunctionPtr, DataSetters<SetFunctionPtr>::Copy, DataSetters<SetFunctionPtr>::Move>(name); }
+
+    /** @brief Collect a data of templated type with a copy and a move setter */
+    template<auto GetFunctionPtr, auto SetCopyFunctionPtr, auto SetMoveFunctionPtr>
+    Builder &data(const HashedName name)
+        { _datas.push_back(MakeData<GetFunctionPtr, SetCopyFunctionPtr, SetMoveFunctionPtr>(name)); return *this; }
+
+    /** @brief Collect a signal of templated type */
+    template<auto SignalPtr>
+    Builder &signal(const HashedName name)
+        { _signals.push_back(MakeSignal<SignalPtr>(name)); return *this; }
+
+    /**
+     * @brief Register every collected member, the builder is emptied
+     *
+     * Members already registered on the type (or collected twice) are an error, in release they are skipped
+     */
+    void commit(void) noexcept_ndebug;
+
+private:
+    std::vector<std::pair<Type, std::ptrdiff_t>> _bases {};
+    std::vector<Constructor> _constructors {};
+    std::vector<Converter> _converters {};
+    std::vector<Function> _functions {};
+    std::vector<Data> _datas {};
+    std::vector<Signal> _signals {};
+
+    /** @brief Append every collected member whose key is not already in 'members', returns the number of skipped duplicates */
+    template<typename Member, typename KeyFunctor>
+    static std::size_t CommitMembers(Core::FlatVector<Member> &members, std::vector<Member> &collected, KeyFunctor &&key);
 };
\ No newline at end of file
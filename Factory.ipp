@@ -3,6 +3,8 @@
  * @ Description: Meta Factory
  */
 
+#include <algorithm>
+
 template<typename RegisteredType>
 inline void kF::Meta::FactoryBase<RegisteredType>::Register(const HashedName name, const HashedName specialization, const std::string_view &literal) noexcept_ndebug
 {
@@ -10,7 +12,10 @@ inline void kF::Meta::FactoryBase<RegisteredType>::Register(const HashedName nam
         throw std::logic_error("Factory::Register: Type already registered"));
     _Descriptor.name = specialization;
     if (!literal.empty())
-        _Descriptor.literal = literal;
+        Resolve().cold().literal = literal;
+#if KF_META_COMPACT_DESCRIPTORS
+    Resolve().setOperators(Internal::OperatorTableInstance<RegisteredType>);
+#endif
     if (name == specialization)
         Resolver::RegisterMetaType(Resolve());
     else
@@ -21,117 +26,260 @@ template<typename RegisteredType>
 template<typename Base>
 inline void kF::Meta::FactoryBase<RegisteredType>::RegisterBase(void) noexcept_ndebug
 {
-    kFAssert(!Resolve().findBase(FactoryBase<Base>::Resolve()),
+    kFAssert(Type::IsValidationDeferred() || !Resolve().findBase(FactoryBase<Base>::Resolve()),
         throw std::logic_error("Factory::RegisterBase: Base already registered"));
-    _Descriptor.bases.push(FactoryBase<Base>::Resolve());
+    Resolve().cold().bases.push(FactoryBase<Base>::Resolve());
+    Resolve().cold().baseOffsets.push(Internal::BaseOffset<RegisteredType, Base>());
+    Type::InvalidateAncestors();
+    Type::InvalidateMembers();
 }
 
 template<typename RegisteredType>
 template<typename ...Args>
 inline kF::Meta::Constructor kF::Meta::FactoryBase<RegisteredType>::RegisterConstructor(void) noexcept_ndebug
 {
-    using FunctionIdentifier = Internal::FunctionIdentifier<FactoryBase<RegisteredType>::RegisterConstructor<Args...>>;
-    using DescriptorInstance = Internal::DescriptorInstance<Constructor::Descriptor, FunctionIdentifier>;
+    const auto constructor = MakeConstructor<Args...>();
 
-    auto &descriptor = DescriptorInstance::Initialize(Constructor::Descriptor::Construct<RegisteredType, Args...>());
-
-    kFAssert(!Resolve().findConstructor<Args...>(),
+    kFAssert(Type::IsValidationDeferred() || !Resolve().findConstructor<Args...>(),
         throw std::logic_error("Factory::RegisterConstructor: Constructor already registered"));
-    _Descriptor.constructors.push(&descriptor);
-    return Constructor(&descriptor);
+    Resolve().cold().constructors.push(constructor);
+    Type::InvalidateConstructors();
+    return constructor;
 }
 
 template<typename RegisteredType>
 template<typename To, auto FunctionPtr>
 inline kF::Meta::Converter kF::Meta::FactoryBase<RegisteredType>::RegisterConverter(void) noexcept_ndebug
 {
-    using FunctionIdentifier = Internal::FunctionIdentifier<FactoryBase<RegisteredType>::RegisterConverter<To, FunctionPtr>>;
-    using DescriptorInstance = Internal::DescriptorInstance<Converter::Descriptor, FunctionIdentifier>;
-
-    auto &descriptor = DescriptorInstance::Initialize(Converter::Descriptor::Construct<RegisteredType, To, FunctionPtr>());
+    const auto converter = MakeConverter<To, FunctionPtr>();
 
-    kFAssert(!Resolve().findConverter(FactoryBase<To>::Resolve()),
+    // Only direct converters are checked, a composite converter may already be resolved for this pair
+    kFAssert(Type::IsValidationDeferred() || std::none_of(Resolve().converters().begin(), Resolve().converters().end(),
+            [](const Converter converter) { return converter.convertType() == FactoryBase<To>::Resolve(); }),
         throw std::logic_error("Factory::RegisterConverter: Converter already registered"));
-    _Descriptor.converters.push(&descriptor);
-    return Converter(&descriptor);
+    Resolve().cold().converters.push(converter);
+    Type::InvalidateConverters();
+    return converter;
 }
 
 template<typename RegisteredType>
 template<auto FunctionPtr>
 inline kF::Meta::Function kF::Meta::FactoryBase<RegisteredType>::RegisterFunction(const HashedName name) noexcept_ndebug
 {
-    using FunctionIdentifier = Internal::FunctionIdentifier<FactoryBase<RegisteredType>::RegisterFunction<FunctionPtr>>;
-    using DescriptorInstance = Internal::DescriptorInstance<Function::Descriptor, FunctionIdentifier>;
-
-    auto &descriptor = DescriptorInstance::Initialize(Function::Descriptor::Construct<RegisteredType, FunctionPtr>(name));
+    const auto function = MakeFunction<FunctionPtr>(name);
 
-    kFAssert(!Resolve().findFunction(name),
+    // Inherited functions are checked too, a type may not hide a member of its bases
+    kFAssert(Type::IsValidationDeferred() || !Resolve().findFunction(name),
         throw std::logic_error("Factory::RegisterFunction: Function already registered"));
-    _Descriptor.functions.push(&descriptor);
-    return Function(&descriptor);
+    Resolve().cold().functions.push(function);
+    Type::InvalidateMembers();
+    return function;
 }
 
 template<typename RegisteredType>
-template<auto GetFunctionPtr, auto SetFunctionPtr>
-inline kF::Meta::Data kF::Meta::FactoryBase<RegisteredType>::RegisterData(const HashedName name) noexcept_ndebug
+template<auto SetFunctionPtr>
+struct kF::Meta::FactoryBase<RegisteredType>::DataSetters
 {
     using SetDecomposer = Internal::FunctionDecomposerHelper<decltype(SetFunctionPtr)>;
 
-    if constexpr (SetFunctionPtr) {
-        static_assert(std::tuple_size_v<typename SetDecomposer::ArgsTuple> == 1, "Meta-data's copy setter must take only one argument");
-    }
-
-    constexpr auto SetCopyFunctionPtr = [] {
+    static constexpr auto Copy = [] {
         if constexpr (SetFunctionPtr) {
+            static_assert(std::tuple_size_v<typename SetDecomposer::ArgsTuple> == 1, "Meta-data's copy setter must take only one argument");
             if constexpr (std::is_rvalue_reference_v<std::tuple_element_t<0u, typename SetDecomposer::ArgsTuple>>)
                 return static_cast<decltype(SetFunctionPtr)>(nullptr);
         }
         return SetFunctionPtr;
     }();
-    constexpr auto SetMoveFunctionPtr = [] {
+
+    static constexpr auto Move = [] {
         if constexpr (SetFunctionPtr) {
             if constexpr (!std::is_rvalue_reference_v<std::tuple_element_t<0u, typename SetDecomposer::ArgsTuple>>)
                 return static_cast<decltype(SetFunctionPtr)>(nullptr);
         }
         return SetFunctionPtr;
     }();
+};
 
-    return RegisterData<GetFunctionPtr, SetCopyFunctionPtr, SetMoveFunctionPtr>(name, signalName);
+template<typename RegisteredType>
+template<auto GetFunctionPtr, auto SetFunctionPtr>
+inline kF::Meta::Data kF::Meta::FactoryBase<RegisteredType>::RegisterData(const HashedName name) noexcept_ndebug
+{
+    return RegisterData<GetFunctionPtr, DataSetters<SetFunctionPtr>::Copy, DataSetters<SetFunctionPtr>::Move>(name);
 }
 
 template<typename RegisteredType>
 template<auto GetFunctionPtr, auto SetCopyFunctionPtr, auto SetMoveFunctionPtr>
 inline kF::Meta::Data kF::Meta::FactoryBase<RegisteredType>::RegisterData(const HashedName name) noexcept_ndebug
+{
+    const auto data = MakeData<GetFunctionPtr, SetCopyFunctionPtr, SetMoveFunctionPtr>(name);
+
+    // Inherited datas are checked too, a type may not hide a member of its bases
+    kFAssert(Type::IsValidationDeferred() || !Resolve().findData(name),
+        throw std::logic_error("Factory::RegisterData: Data already registered"));
+    Resolve().cold().datas.push(data);
+    Type::InvalidateMembers();
+    return data;
+}
+
+template<typename RegisteredType>
+template<auto SignalPtr>
+inline kF::Meta::Signal kF::Meta::FactoryBase<RegisteredType>::RegisterSignal(const HashedName name) noexcept_ndebug
+{
+    const auto signal = MakeSignal<SignalPtr>(name);
+
+    kFAssert(Type::IsValidationDeferred() || !Resolve().findSignal<SignalPtr>(),
+        throw std::logic_error("Factory::RegisterSignal: Signal already registered"));
+    Resolve().cold().signals.push(signal);
+    Type::InvalidateMembers();
+    return signal;
+}
+
+template<typename RegisteredType>
+template<typename ...Args>
+inline kF::Meta::Constructor kF::Meta::FactoryBase<RegisteredType>::MakeConstructor(void) noexcept
+{
+    using FunctionIdentifier = Internal::FunctionIdentifier<FactoryBase<RegisteredType>::RegisterConstructor<Args...>>;
+    using DescriptorInstance = Internal::DescriptorInstance<Constructor::Descriptor, FunctionIdentifier>;
+
+    return Constructor(&DescriptorInstance::Initialize(Constructor::Descriptor::Construct<RegisteredType, Args...>()));
+}
+
+template<typename RegisteredType>
+template<typename To, auto FunctionPtr>
+inline kF::Meta::Converter kF::Meta::FactoryBase<RegisteredType>::MakeConverter(void) noexcept
+{
+    using FunctionIdentifier = Internal::FunctionIdentifier<FactoryBase<RegisteredType>::RegisterConverter<To, FunctionPtr>>;
+    using DescriptorInstance = Internal::DescriptorInstance<Converter::Descriptor, FunctionIdentifier>;
+
+    return Converter(&DescriptorInstance::Initialize(Converter::Descriptor::Construct<RegisteredType, To, FunctionPtr>()));
+}
+
+template<typename RegisteredType>
+template<auto FunctionPtr>
+inline kF::Meta::Function kF::Meta::FactoryBase<RegisteredType>::MakeFunction(const HashedName name) noexcept
+{
+    using FunctionIdentifier = Internal::FunctionIdentifier<FactoryBase<RegisteredType>::RegisterFunction<FunctionPtr>>;
+    using DescriptorInstance = Internal::DescriptorInstance<Function::Descriptor, FunctionIdentifier>;
+
+    return Function(&DescriptorInstance::Initialize(Function::Descriptor::Construct<RegisteredType, FunctionPtr>(name)));
+}
+
+template<typename RegisteredType>
+template<auto GetFunctionPtr, auto SetCopyFunctionPtr, auto SetMoveFunctionPtr>
+inline kF::Meta::Data kF::Meta::FactoryBase<RegisteredType>::MakeData(const HashedName name) noexcept
 {
     using FunctionIdentifier = Internal::FunctionIdentifier<FactoryBase<RegisteredType>::RegisterData<GetFunctionPtr, SetCopyFunctionPtr, SetMoveFunctionPtr>>;
     using DescriptorInstance = Internal::DescriptorInstance<Data::Descriptor, FunctionIdentifier>;
 
-    auto &descriptor = DescriptorInstance::Initialize(
+    return Data(&DescriptorInstance::Initialize(
         Data::Descriptor::Construct<
             RegisteredType,
             GetFunctionPtr,
             SetCopyFunctionPtr,
             SetMoveFunctionPtr
         >(name)
-    );
-
-    kFAssert(!Resolve().findData(name),
-        throw std::logic_error("Factory::RegisterData: Data already registered"));
-    _Descriptor.datas.push(&descriptor);
-    return Data(&descriptor);
+    ));
 }
 
 template<typename RegisteredType>
 template<auto SignalPtr>
-inline kF::Meta::Signal kF::Meta::FactoryBase<RegisteredType>::RegisterSignal(const HashedName name) noexcept_ndebug
+inline kF::Meta::Signal kF::Meta::FactoryBase<RegisteredType>::MakeSignal(const HashedName name) noexcept
 {
     using FunctionIdentifier = Internal::FunctionIdentifier<FactoryBase<RegisteredType>::RegisterSignal<SignalPtr>>;
     using DescriptorInstance = Internal::DescriptorInstance<Signal::Descriptor, FunctionIdentifier>;
 
-    auto &descriptor = DescriptorInstance::Initialize(Signal::Descriptor::Construct<SignalPtr>(name));
+    return Signal(&DescriptorInstance::Initialize(Signal::Descriptor::Construct<SignalPtr>(name)));
+}
 
-    kFAssert(!Resolve().findSignal<SignalPtr>(),
-        throw std::logic_error("Factory::RegisterSignal: Signal already registered"));
-    _Descriptor.signals.push(&descriptor);
-    return Signal(&descriptor);
-}
\ No newline at end of file
+template<typename RegisteredType>
+inline void kF::Meta::FactoryBase<RegisteredType>::Builder::commit(void) noexcept_ndebug
+{
+    auto &cold = Resolve().cold();
+    const auto argTypes = [](const Constructor ctor) {
+        std::vector<Type::TypeID> types;
+        types.reserve(ctor.argsCount());
+        for (auto i = 0u; i != ctor.argsCount(); ++i)
+            types.push_back(ctor.argType(i).typeID());
+        return types;
+    };
+    [[maybe_unused]] auto duplicates = 0ul;
+
+    // Types usually have few bases, they are checked linearly
+    if (!_bases.empty()) {
+        const auto first = cold.bases.size();
+        cold.bases.reserve(first + _bases.size());
+        cold.baseOffsets.reserve(first + _bases.size());
+        for (const auto &[base, offset] : _bases) {
+            if (std::find(cold.bases.begin(), cold.bases.end(), base) != cold.bases.end()) {
+                ++duplicates;
+                continue;
+            }
+            cold.bases.push(base);
+            cold.baseOffsets.push(offset);
+        }
+        _bases.clear();
+        kFAssert(!duplicates,
+            throw std::logic_error("Factory::Builder::commit: Base already registered"));
+        Type::InvalidateAncestors();
+        Type::InvalidateMembers();
+    }
+    if (!_constructors.empty()) {
+        duplicates = CommitMembers(cold.constructors, _constructors, argTypes);
+        kFAssert(!duplicates,
+            throw std::logic_error("Factory::Builder::commit: Constructor already registered"));
+        Type::InvalidateConstructors();
+    }
+    if (!_converters.empty()) {
+        duplicates = CommitMembers(cold.converters, _converters, [](const Converter converter) { return converter.convertType().typeID(); });
+        kFAssert(!duplicates,
+            throw std::logic_error("Factory::Builder::commit: Converter already registered"));
+        Type::InvalidateConverters();
+    }
+    if (!_functions.empty() || !_datas.empty() || !_signals.empty()) {
+        duplicates = CommitMembers(cold.functions, _functions, [](const Function function) { return function.name(); });
+        kFAssert(!duplicates,
+            throw std::logic_error("Factory::Builder::commit: Function already registered"));
+        duplicates = CommitMembers(cold.datas, _datas, [](const Data data) { return data.name(); });
+        kFAssert(!duplicates,
+            throw std::logic_error("Factory::Builder::commit: Data already registered"));
+        duplicates = CommitMembers(cold.signals, _signals, [](const Signal signal) { return signal.signalPtr(); });
+        kFAssert(!duplicates,
+            throw std::logic_error("Factory::Builder::commit: Signal already registered"));
+        Type::InvalidateMembers();
+    }
+}
+
+template<typename RegisteredType>
+template<typename Member, typename KeyFunctor>
+inline std::size_t kF::Meta::FactoryBase<RegisteredType>::Builder::CommitMembers(
+        Core::FlatVector<Member> &members, std::vector<Member> &collected, KeyFunctor &&key)
+{
+    using Key = decltype(key(collected.front()));
+
+    const auto registered = static_cast<std::size_t>(members.size());
+    std::vector<std::pair<Key, std::size_t>> keys; // Key -> position, registered members first
+    std::vector<bool> skipped(collected.size(), false);
+    auto duplicates = 0ul;
+
+    if (collected.empty())
+        return 0ul;
+    keys.reserve(registered + collected.size());
+    for (auto i = 0ul; i != registered; ++i)
+        keys.emplace_back(key(members[i]), i);
+    for (auto i = 0ul; i != collected.size(); ++i)
+        keys.emplace_back(key(collected[i]), registered + i);
+    // Equal keys are sorted by position, only the first one of each range is kept
+    std::sort(keys.begin(), keys.end());
+    for (auto i = 1ul; i < keys.size(); ++i) {
+        if (keys[i].first == keys[i - 1].first && keys[i].second >= registered) {
+            skipped[keys[i].second - registered] = true;
+            ++duplicates;
+        }
+    }
+    members.reserve(registered + collected.size() - duplicates);
+    for (auto i = 0ul; i != collected.size(); ++i)
+        if (!skipped[i])
+            members.push(collected[i]);
+    collected.clear();
+    return duplicates;
+}
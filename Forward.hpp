@@ -7,8 +7,6 @@
 
 namespace kF
 {
-    class Var;
-
     namespace Meta
     {
         class Type;
@@ -19,11 +17,45 @@ namespace kF
         class SlotTable;
         class Signal;
         class Resolver;
+        class VarHeapAllocator;
+        class VarPoolAllocator;
+        class VarMonotonicAllocator;
+
+        /** @brief Allocator of heap stored Var values */
+        using VarDefaultAllocator = std::conditional_t<KF_META_VAR_POOL_ALLOCATOR, VarPoolAllocator, VarHeapAllocator>;
+
+        template<typename Member, std::size_t Ways = 4>
+        class MemberCache;
+
+        using FunctionCache = MemberCache<Function>;
+        using DataCache = MemberCache<Data>;
 
         template<typename RegisteredType>
         class FactoryBase;
 
         template<typename RegisteredType>
         using Factory = FactoryBase<std::remove_cvref_t<RegisteredType>>;
+
+        namespace Internal
+        {
+            class HashIndex;
+            class PerfectHashIndex;
+            class ConversionMatrix;
+            class ConcurrentHashIndex;
+            class VarPool;
+
+            template<typename Type>
+            class AppendVector;
+
+            template<typename Value>
+            class Published;
+        }
     }
+
+    template<std::size_t InlineSize = KF_META_VAR_SMALL_OPTIMIZATION_SIZE, std::size_t Alignment = KF_META_VAR_SMALL_OPTIMIZATION_ALIGNMENT,
+            typename Allocator = Meta::VarDefaultAllocator>
+    class BasicVar;
+
+    /** @brief Var using the default small optimization size and allocator */
+    using Var = BasicVar<>;
 }
\ No newline at end of file
@@ -21,8 +21,9 @@ public:
         const HashedName name { 0u };
         const bool isStatic { false };
         const bool isConst { false };
-        const std::size_t argsCount { 0u };
+        const std::uint16_t argsCount { 0u };
         const Type returnType {};
+        const Type ownerType {};
         const ArgTypeFunc argTypeFunc { nullptr };
         const InvokeFunc invokeFunc {};
 
@@ -63,9 +64,13 @@ public:
     /** @brief Check if the underlying function is a const-member */
     [[nodiscard]] bool isConst(void) const noexcept { return _desc->isConst; }
 
-    /** @brief Invoke a member function using a var instance */
+    /** @brief Retreive the type that registered the function */
+    [[nodiscard]] Type ownerType(void) const noexcept { return _desc->ownerType; }
+
+    /** @brief Invoke a member function using a var instance, the instance is adjusted if the function belongs to one of its bases */
     template<typename ...Args>
-    [[nodiscard]] Var invoke(const Var &instance, Args &&...args) const { return invoke(instance.data(), std::forward<Args>(args)...); }
+    [[nodiscard]] Var invoke(const Var &instance, Args &&...args) const
+        { return invoke(adjustInstance(instance), std::forward<Args>(args)...); }
 
     /** @brief Invoke a member function */
     template<typename ...Args>
@@ -73,8 +78,11 @@ public:
 
     /** @brief Invoke a static function */
     template<typename ...Args>
-    [[nodiscard]] Var invoke(Args &&...args) const { return invoke(nullptr, std::forward<Args>(args)...); }
+    [[nodiscard]] Var invoke(Args &&...args) const { return invoke(static_cast<const void *>(nullptr), std::forward<Args>(args)...); }
 
 private:
     const Descriptor *_desc = nullptr;
+
+    /** @brief Adjust an instance to the type that registered the function (nullptr if the function is static) */
+    [[nodiscard]] const void *adjustInstance(const Var &instance) const;
 };
\ No newline at end of file
@@ -11,10 +11,11 @@ inline kF::Meta::Function::Descriptor kF::Meta::Function::Descriptor::Construct(
 
     return Descriptor {
         name: name,
-        argsCount: std::tuple_size_v<typename Decomposer::ArgsTuple>,
         isStatic: !std::is_member_function_pointer_v<FunctionType>,
         isConst: Decomposer::IsConst,
+        argsCount: std::tuple_size_v<typename Decomposer::ArgsTuple>,
         returnType: Factory<typename Decomposer::ReturnType>::Resolve(),
+        ownerType: Factory<Type>::Resolve(),
         argTypeFunc: &Decomposer::ArgType,
         invokeFunc: [](const void *instance, Var *args) {
             return Internal::Invoke<Type, FunctionPtr, true, Decomposer>(instance, args, Decomposer::IndexSequence);
@@ -28,5 +29,16 @@ inline kF::Var kF::Meta::Function::invoke(const void *instance, Args &&...args)
     kFAssert(sizeof...(Args) == argsCount(),
         return Var());
     Var arguments[] { Var::Assign(std::forward<Args>(args))... };
-    return (*_desc->invokeFunc)(instance, arguments).operator bool();
+    return (*_desc->invokeFunc)(instance, arguments);
+}
+
+inline const void *kF::Meta::Function::adjustInstance(const Var &instance) const
+{
+    if (isStatic())
+        return nullptr;
+    const auto adjusted = instance.type().upcast(ownerType(), instance.data());
+
+    kFAssert(adjusted,
+        throw std::runtime_error("Meta::Function::invoke: Instance type is not related to the type that registered the function"));
+    return adjusted;
 }
\ No newline at end of file
@@ -0,0 +1,73 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Meta hash index
+ */
+
+#pragma once
+
+#include <Kube/Core/Vector.hpp>
+
+#include "Base.hpp"
+
+/**
+ * @brief HashIndex maps 64 bits keys to positions inside an external contiguous storage
+ *
+ * Buckets are linearly probed and the table is kept at most half full so probe sequences stay short.
+ * Several positions may share the same key, lookups use a predicate to discriminate them.
+ */
+class kF::Meta::Internal::HashIndex
+{
+public:
+    /** @brief Key of an indexed element */
+    using Key = std::uint64_t;
+
+    /** @brief Position of an indexed element in its external storage */
+    using Position = std::uint32_t;
+
+    /** @brief Position returned when a key is not found (also used to mark empty buckets) */
+    static constexpr Position NullPosition = ~static_cast<Position>(0);
+
+    /** @brief Minimum bucket count allocated on first insertion */
+    static constexpr Position MinBucketCount = 16u;
+
+    /** @brief An indexing slot */
+    struct Bucket
+    {
+        Key key {};
+        Position position { NullPosition };
+    };
+
+    /** @brief Insert a position under a given key */
+    void insert(const Key key, const Position position);
+
+    /** @brief Find the first position of a given key that satisfies a predicate */
+    template<typename Predicate>
+    [[nodiscard]] Position find(const Key key, Predicate &&predicate) const noexcept;
+
+    /** @brief Find the first position of a given key */
+    [[nodiscard]] Position find(const Key key) const noexcept
+        { return find(key, [](const Position) { return true; }); }
+
+    /** @brief Get the number of indexed positions */
+    [[nodiscard]] Position size(void) const noexcept { return _size; }
+
+    /** @brief Clear the index */
+    void clear(void) noexcept;
+
+    /** @brief Mix a key to spread its bits before masking */
+    [[nodiscard]] static Key Mix(Key key) noexcept;
+
+    /** @brief Combine two keys into a single one */
+    [[nodiscard]] static Key Combine(const Key lhs, const Key rhs) noexcept { return Mix(lhs) ^ rhs; }
+
+private:
+    Core::Vector<Bucket> _buckets {};
+    Position _size { 0u };
+    Position _mask { 0u };
+
+    /** @brief Double the bucket count and re-index every position */
+    void grow(void);
+
+    /** @brief Insert a position without checking the load factor */
+    void insertUnsafe(const Key key, const Position position) noexcept;
+};
@@ -0,0 +1,68 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Meta hash index
+ */
+
+#include <algorithm>
+
+inline void kF::Meta::Internal::HashIndex::insert(const Key key, const Position position)
+{
+    if ((_size + 1u) * 2u > _buckets.size()) [[unlikely]]
+        grow();
+    insertUnsafe(key, position);
+    ++_size;
+}
+
+template<typename Predicate>
+inline kF::Meta::Internal::HashIndex::Position kF::Meta::Internal::HashIndex::find(const Key key, Predicate &&predicate) const noexcept
+{
+    if (!_size) [[unlikely]]
+        return NullPosition;
+    for (auto index = static_cast<Position>(Mix(key)) & _mask; ; index = (index + 1u) & _mask) {
+        const auto &bucket = _buckets[index];
+        if (bucket.position == NullPosition)
+            return NullPosition;
+        else if (bucket.key == key && predicate(bucket.position)) [[likely]]
+            return bucket.position;
+    }
+}
+
+inline void kF::Meta::Internal::HashIndex::clear(void) noexcept
+{
+    _buckets.clear();
+    _size = 0u;
+    _mask = 0u;
+}
+
+inline kF::Meta::Internal::HashIndex::Key kF::Meta::Internal::HashIndex::Mix(Key key) noexcept
+{
+    key ^= key >> 33u;
+    key *= 0xFF51AFD7ED558CCDull;
+    key ^= key >> 33u;
+    return key;
+}
+
+inline void kF::Meta::Internal::HashIndex::grow(void)
+{
+    const auto bucketCount = std::max(MinBucketCount, static_cast<Position>(_buckets.size() * 2u));
+    Core::Vector<Bucket> buckets(std::move(_buckets));
+
+    _buckets = Core::Vector<Bucket>(bucketCount);
+    _mask = bucketCount - 1u;
+    // Re-insert positions in their original order so that duplicated keys keep their priority
+    std::sort(buckets.begin(), buckets.end(), [](const Bucket &lhs, const Bucket &rhs) { return lhs.position < rhs.position; });
+    for (const auto &bucket : buckets) {
+        if (bucket.position == NullPosition)
+            break;
+        insertUnsafe(bucket.key, bucket.position);
+    }
+}
+
+inline void kF::Meta::Internal::HashIndex::insertUnsafe(const Key key, const Position position) noexcept
+{
+    auto index = static_cast<Position>(Mix(key)) & _mask;
+
+    while (_buckets[index].position != NullPosition)
+        index = (index + 1u) & _mask;
+    _buckets[index] = Bucket { key, position };
+}
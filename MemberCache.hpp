@@ -0,0 +1,59 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Meta member cache
+ */
+
+#pragma once
+
+#include "Function.hpp"
+#include "Data.hpp"
+
+/**
+ * @brief MemberCache memoizes the last resolutions of a member name for a few receiver types
+ *
+ * A cache is meant to be kept at a call site that repeatedly looks up the same name.
+ * Entries are dropped each time the members of any type change (registration, Type::clear or Resolver::Clear).
+ * A cache is not thread safe, each thread must use its own instance.
+ */
+template<typename Member, std::size_t Ways>
+class kF::Meta::MemberCache
+{
+public:
+    static_assert(std::is_same_v<Member, Function> || std::is_same_v<Member, Data>,
+        "Meta::MemberCache: Only functions and datas can be cached");
+    static_assert(Ways != 0u, "Meta::MemberCache: A cache must have at least one way");
+
+    /** @brief A memoized resolution */
+    struct Entry
+    {
+        Type type {};
+        Member member {};
+    };
+
+    /** @brief Construct a cache of a given member name */
+    MemberCache(const HashedName name) noexcept : _name(name) {}
+
+    /** @brief Copy constructor */
+    MemberCache(const MemberCache &other) noexcept = default;
+
+    /** @brief Copy assignment */
+    MemberCache &operator=(const MemberCache &other) noexcept = default;
+
+    /** @brief Get the cached member name */
+    [[nodiscard]] HashedName name(void) const noexcept { return _name; }
+
+    /** @brief Find the member of a given type, using the cache if possible */
+    [[nodiscard]] Member find(const Type type) noexcept;
+
+    /** @brief Drop every memoized resolution */
+    void clear(void) noexcept;
+
+private:
+    Entry _entries[Ways] {};
+    std::uint32_t _generation { 0u };
+    std::uint32_t _next { 0u };
+    HashedName _name {};
+
+    /** @brief Resolve a member and memoize it */
+    [[nodiscard]] Member resolve(const Type type) noexcept;
+};
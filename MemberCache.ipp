@@ -0,0 +1,43 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Meta member cache
+ */
+
+template<typename Member, std::size_t Ways>
+inline Member kF::Meta::MemberCache<Member, Ways>::find(const Type type) noexcept
+{
+    if (_generation == Type::MembersGeneration()) [[likely]] {
+        for (const auto &entry : _entries) {
+            if (entry.type == type) [[likely]]
+                return entry.member;
+        }
+    }
+    return resolve(type);
+}
+
+template<typename Member, std::size_t Ways>
+inline void kF::Meta::MemberCache<Member, Ways>::clear(void) noexcept
+{
+    for (auto &entry : _entries)
+        entry = Entry();
+    _generation = 0u;
+    _next = 0u;
+}
+
+template<typename Member, std::size_t Ways>
+inline Member kF::Meta::MemberCache<Member, Ways>::resolve(const Type type) noexcept
+{
+    if (_generation != Type::MembersGeneration()) {
+        clear();
+        _generation = Type::MembersGeneration();
+    }
+    Member member;
+    if constexpr (std::is_same_v<Member, Function>)
+        member = type.findFunction(_name);
+    else
+        member = type.findData(_name);
+    // Entries are replaced in round-robin, misses are memoized too
+    _entries[_next] = Entry { type: type, member: member };
+    _next = (_next + 1u) % Ways;
+    return member;
+}
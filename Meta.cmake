@@ -3,12 +3,18 @@ project(KubeMeta)
 get_filename_component(KubeMetaDir ${CMAKE_CURRENT_LIST_FILE} PATH)
 
 set(KubeMetaSources
+    ${KubeMetaDir}/AppendVector.hpp
+    ${KubeMetaDir}/AppendVector.ipp
     ${KubeMetaDir}/Base.hpp
     ${KubeMetaDir}/Base.ipp
     ${KubeMetaDir}/Constructor.hpp
     ${KubeMetaDir}/Constructor.ipp
     ${KubeMetaDir}/Converter.hpp
     ${KubeMetaDir}/Converter.ipp
+    ${KubeMetaDir}/ConversionMatrix.hpp
+    ${KubeMetaDir}/ConversionMatrix.ipp
+    ${KubeMetaDir}/ConcurrentHashIndex.hpp
+    ${KubeMetaDir}/ConcurrentHashIndex.ipp
     ${KubeMetaDir}/Data.hpp
     ${KubeMetaDir}/Data.ipp
     ${KubeMetaDir}/Factory.hpp
@@ -16,6 +22,14 @@ set(KubeMetaSources
     ${KubeMetaDir}/Forward.hpp
     ${KubeMetaDir}/Function.hpp
     ${KubeMetaDir}/Function.ipp
+    ${KubeMetaDir}/HashIndex.hpp
+    ${KubeMetaDir}/HashIndex.ipp
+    ${KubeMetaDir}/MemberCache.hpp
+    ${KubeMetaDir}/MemberCache.ipp
+    ${KubeMetaDir}/PerfectHashIndex.hpp
+    ${KubeMetaDir}/PerfectHashIndex.ipp
+    ${KubeMetaDir}/Published.hpp
+    ${KubeMetaDir}/Published.ipp
     ${KubeMetaDir}/Resolver.hpp
     ${KubeMetaDir}/Resolver.ipp
     ${KubeMetaDir}/Registerer.hpp
@@ -23,6 +37,8 @@ set(KubeMetaSources
     ${KubeMetaDir}/SlotTable.ipp
     ${KubeMetaDir}/Signal.hpp
     ${KubeMetaDir}/Signal.ipp
+    ${KubeMetaDir}/VarAllocator.hpp
+    ${KubeMetaDir}/VarAllocator.ipp
     ${KubeMetaDir}/Var.hpp
     ${KubeMetaDir}/Var.ipp
     ${KubeMetaDir}/Type.hpp
@@ -41,6 +57,14 @@ PUBLIC
     KubeCore
 )
 
+if(${KF_META_COMPACT_DESCRIPTORS})
+    target_compile_definitions(${PROJECT_NAME} PUBLIC KF_META_COMPACT_DESCRIPTORS=1)
+endif()
+
+if(${KF_META_VAR_POOL_ALLOCATOR})
+    target_compile_definitions(${PROJECT_NAME} PUBLIC KF_META_VAR_POOL_ALLOCATOR=1)
+endif()
+
 if(${KF_TESTS})
     include(${KubeMetaDir}/Tests/MetaTests.cmake)
 endif()
@@ -7,6 +7,11 @@
 
 /* Header declaration */
 #include "Base.hpp"
+#include "AppendVector.hpp"
+#include "Published.hpp"
+#include "HashIndex.hpp"
+#include "ConcurrentHashIndex.hpp"
+#include "PerfectHashIndex.hpp"
 #include "Type.hpp"
 #include "Constructor.hpp"
 #include "Converter.hpp"
@@ -15,11 +20,19 @@
 #include "Signal.hpp"
 #include "Data.hpp"
 #include "Factory.hpp"
+#include "ConversionMatrix.hpp"
 #include "Resolver.hpp"
+#include "MemberCache.hpp"
+#include "VarAllocator.hpp"
 #include "Var.hpp"
 
 /* Header definition */
 #include "Base.ipp"
+#include "AppendVector.ipp"
+#include "Published.ipp"
+#include "HashIndex.ipp"
+#include "ConcurrentHashIndex.ipp"
+#include "PerfectHashIndex.ipp"
 #include "Type.ipp"
 #include "Constructor.ipp"
 #include "Converter.ipp"
@@ -28,5 +41,8 @@
 #include "Signal.ipp"
 #include "Data.ipp"
 #include "Factory.ipp"
+#include "ConversionMatrix.ipp"
 #include "Resolver.ipp"
+#include "MemberCache.ipp"
+#include "VarAllocator.ipp"
 #include "Var.ipp"
\ No newline at end of file
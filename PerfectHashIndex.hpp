@@ -0,0 +1,75 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Meta perfect hash index
+ */
+
+#pragma once
+
+#include "HashIndex.hpp"
+
+/**
+ * @brief PerfectHashIndex is an immutable index that maps a set of unique keys to positions with a single probe
+ *
+ * Keys are first dispatched into small buckets, then each bucket receives a seed that places all its keys
+ * into free slots without any collision (hash and displace).
+ * Unlike HashIndex, a PerfectHashIndex can't be modified once built.
+ */
+class kF::Meta::Internal::PerfectHashIndex
+{
+public:
+    /** @brief Key of an indexed element */
+    using Key = HashIndex::Key;
+
+    /** @brief Position of an indexed element in its external storage */
+    using Position = HashIndex::Position;
+
+    /** @brief Position returned when a key is not found (also used to mark empty slots) */
+    static constexpr Position NullPosition = HashIndex::NullPosition;
+
+    /** @brief Average number of keys per bucket */
+    static constexpr Position BucketLoad = 4u;
+
+    /** @brief Maximum number of seeds tried for a single bucket before growing the slot table */
+    static constexpr std::uint32_t MaxSeedTries = 1u << 16u;
+
+    /** @brief An indexing slot, also used as build input */
+    struct Slot
+    {
+        Key key {};
+        Position position { NullPosition };
+    };
+
+    /**
+     * @brief Build the index from a list of entries
+     *
+     * Returns false if two entries share the same key, in that case the index is left empty
+     */
+    bool build(const Core::Vector<Slot> &entries);
+
+    /** @brief Find the position of a given key */
+    [[nodiscard]] Position find(const Key key) const noexcept;
+
+    /** @brief Get the number of indexed positions */
+    [[nodiscard]] Position size(void) const noexcept { return _size; }
+
+    /** @brief Clear the index */
+    void clear(void) noexcept;
+
+private:
+    Core::Vector<std::uint32_t> _seeds {};
+    Core::Vector<Slot> _slots {};
+    Position _size { 0u };
+    Position _bucketMask { 0u };
+    Position _slotMask { 0u };
+
+    /** @brief Try to place every entry into a slot table of a given size */
+    [[nodiscard]] bool tryBuild(const Core::Vector<Slot> &entries, const Position slotCount);
+
+    /** @brief Get the bucket of a key */
+    [[nodiscard]] Position bucketIndex(const Key key) const noexcept
+        { return static_cast<Position>(HashIndex::Mix(key) >> 32u) & _bucketMask; }
+
+    /** @brief Get the slot of a key knowing its bucket seed */
+    [[nodiscard]] Position slotIndex(const Key key, const std::uint32_t seed) const noexcept
+        { return static_cast<Position>(HashIndex::Mix(key ^ (seed * 0x9E3779B97F4A7C15ull))) & _slotMask; }
+};
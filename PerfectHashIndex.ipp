@@ -0,0 +1,96 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Meta perfect hash index
+ */
+
+#include <algorithm>
+#include <bit>
+
+inline bool kF::Meta::Internal::PerfectHashIndex::build(const Core::Vector<Slot> &entries)
+{
+    clear();
+    if (entries.empty()) [[unlikely]]
+        return true;
+    // Reject duplicated keys, they can't be perfectly hashed
+    Core::Vector<Key> keys;
+    for (const auto &entry : entries)
+        keys.push(entry.key);
+    std::sort(keys.begin(), keys.end());
+    if (std::adjacent_find(keys.begin(), keys.end()) != keys.end()) [[unlikely]]
+        return false;
+    // Slots are kept at most 3/4 full, the table is doubled each time a bucket can't be placed
+    auto slotCount = std::bit_ceil(static_cast<Position>(entries.size()));
+    if (entries.size() * 4u > slotCount * 3u)
+        slotCount *= 2u;
+    while (!tryBuild(entries, slotCount))
+        slotCount *= 2u;
+    return true;
+}
+
+inline kF::Meta::Internal::PerfectHashIndex::Position kF::Meta::Internal::PerfectHashIndex::find(const Key key) const noexcept
+{
+    if (!_size) [[unlikely]]
+        return NullPosition;
+    const auto &slot = _slots[slotIndex(key, _seeds[bucketIndex(key)])];
+    if (slot.key == key) [[likely]]
+        return slot.position;
+    return NullPosition;
+}
+
+inline void kF::Meta::Internal::PerfectHashIndex::clear(void) noexcept
+{
+    _seeds.clear();
+    _slots.clear();
+    _size = 0u;
+    _bucketMask = 0u;
+    _slotMask = 0u;
+}
+
+inline bool kF::Meta::Internal::PerfectHashIndex::tryBuild(const Core::Vector<Slot> &entries, const Position slotCount)
+{
+    const auto bucketCount = std::bit_ceil(std::max(static_cast<Position>(entries.size()) / BucketLoad, 1u));
+    Core::Vector<Slot> sorted(entries);
+    Core::Vector<Position> used;
+
+    _seeds = Core::Vector<std::uint32_t>(bucketCount);
+    _slots = Core::Vector<Slot>(slotCount);
+    _bucketMask = bucketCount - 1u;
+    _slotMask = slotCount - 1u;
+    // Group entries by bucket, largest buckets are placed first as they are the hardest to fit
+    std::sort(sorted.begin(), sorted.end(), [this](const Slot &lhs, const Slot &rhs) {
+        return bucketIndex(lhs.key) < bucketIndex(rhs.key);
+    });
+    Core::Vector<std::pair<Position, Position>> ranges;
+    for (auto begin = 0u; begin != sorted.size();) {
+        auto end = begin + 1u;
+        while (end != sorted.size() && bucketIndex(sorted[end].key) == bucketIndex(sorted[begin].key))
+            ++end;
+        ranges.push(std::make_pair(begin, end));
+        begin = end;
+    }
+    std::stable_sort(ranges.begin(), ranges.end(), [](const auto &lhs, const auto &rhs) {
+        return lhs.second - lhs.first > rhs.second - rhs.first;
+    });
+    for (const auto &[begin, end] : ranges) {
+        auto seed = 0u;
+        for (; seed != MaxSeedTries; ++seed) {
+            used.clear();
+            auto i = begin;
+            for (; i != end; ++i) {
+                const auto index = slotIndex(sorted[i].key, seed);
+                if (_slots[index].position != NullPosition || std::find(used.begin(), used.end(), index) != used.end())
+                    break;
+                used.push(index);
+            }
+            if (i == end)
+                break;
+        }
+        if (seed == MaxSeedTries) [[unlikely]]
+            return false;
+        _seeds[bucketIndex(sorted[begin].key)] = seed;
+        for (auto i = begin; i != end; ++i)
+            _slots[slotIndex(sorted[i].key, seed)] = sorted[i];
+    }
+    _size = static_cast<Position>(entries.size());
+    return true;
+}
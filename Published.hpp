@@ -0,0 +1,70 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Meta published value
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "Base.hpp"
+
+/**
+ * @brief Published holds an immutable value that readers access without locking
+ *
+ * A writer replaces the value by publishing a new one atomically.
+ * Readers may still hold a replaced value, so it is retired and only released by 'releaseRetired' or 'clear'.
+ * Writers must be serialized externally.
+ */
+template<typename Value>
+class kF::Meta::Internal::Published
+{
+public:
+    /** @brief Default constructor */
+    Published(void) noexcept = default;
+
+    /** @brief Destructor */
+    ~Published(void) noexcept { clear(); }
+
+    /** @brief Published is not copyable */
+    Published(const Published &other) = delete;
+    Published &operator=(const Published &other) = delete;
+
+    /** @brief Move assignment, releases every value of the instance (must not run concurrently with any reader) */
+    Published &operator=(Published &&other) noexcept
+        { clear(); _node.store(other._node.exchange(nullptr, std::memory_order_relaxed), std::memory_order_release); return *this; }
+
+    /** @brief Get the published value, nullptr if none (thread safe) */
+    [[nodiscard]] const Value *get(void) const noexcept;
+
+    /** @brief Publish a new value, the previous one is retired (not thread safe against other writers) */
+    const Value &publish(Value &&value);
+
+    /** @brief Publish a new value constructed in place, the previous one is retired (not thread safe against other writers) */
+    template<typename ...Args>
+    Value &emplace(Args &&...args);
+
+    /**
+     * @brief Get the published value to modify it in place, nullptr if none (not thread safe against other writers)
+     *
+     * Only values whose modifications are safe against concurrent readers may be edited, others must be republished
+     */
+    [[nodiscard]] Value *edit(void) noexcept;
+
+    /** @brief Release every retired value, must not run concurrently with any reader */
+    void releaseRetired(void) noexcept;
+
+    /** @brief Release every value, must not run concurrently with any reader */
+    void clear(void) noexcept;
+
+private:
+    /** @brief A published value linked to the one it replaced */
+    struct Node
+    {
+        Value value;
+        std::unique_ptr<Node> retired {};
+    };
+
+    std::atomic<Node *> _node { nullptr };
+};
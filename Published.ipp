@@ -0,0 +1,60 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Meta published value
+ */
+
+template<typename Value>
+inline const Value *kF::Meta::Internal::Published<Value>::get(void) const noexcept
+{
+    const auto node = _node.load(std::memory_order_acquire);
+
+    return node ? &node->value : nullptr;
+}
+
+template<typename Value>
+inline const Value &kF::Meta::Internal::Published<Value>::publish(Value &&value)
+{
+    auto node = std::make_unique<Node>(Node { std::move(value) });
+
+    // Readers may still hold the previous value, it is kept alive until retired values are released
+    node->retired = std::unique_ptr<Node>(_node.load(std::memory_order_relaxed));
+    _node.store(node.get(), std::memory_order_release);
+    return node.release()->value;
+}
+
+template<typename Value>
+template<typename ...Args>
+inline Value &kF::Meta::Internal::Published<Value>::emplace(Args &&...args)
+{
+    // The value is constructed inside its node, so it doesn't have to be movable
+    auto node = std::unique_ptr<Node>(new Node { Value { std::forward<Args>(args)... } });
+
+    node->retired = std::unique_ptr<Node>(_node.load(std::memory_order_relaxed));
+    _node.store(node.get(), std::memory_order_release);
+    return node.release()->value;
+}
+
+template<typename Value>
+inline Value *kF::Meta::Internal::Published<Value>::edit(void) noexcept
+{
+    const auto node = _node.load(std::memory_order_relaxed);
+
+    return node ? &node->value : nullptr;
+}
+
+template<typename Value>
+inline void kF::Meta::Internal::Published<Value>::releaseRetired(void) noexcept
+{
+    const auto node = _node.load(std::memory_order_relaxed);
+
+    // Retired values are released one by one, recursive destruction of a long chain could overflow the stack
+    if (node)
+        for (auto retired = std::move(node->retired); retired; retired = std::move(retired->retired));
+}
+
+template<typename Value>
+inline void kF::Meta::Internal::Published<Value>::clear(void) noexcept
+{
+    releaseRetired();
+    delete _node.exchange(nullptr, std::memory_order_acq_rel);
+}
@@ -42,7 +42,7 @@ struct IsStaticCastable<From, To, decltype(static_cast<To>(std::declval<From>())
     RegisterConverterHelper(Type, double);
 
 
-void Meta::RegisterMetadata(void)
+static void RegisterBaseTypes(void)
 {
     RegisterType(bool,              "bool");
     RegisterType(char,              "char");
@@ -56,8 +56,19 @@ void Meta::RegisterMetadata(void)
     RegisterType(float,             "float");
     RegisterType(double,            "double");
     RegisterType(std::string,       "string");
+}
+
+void Meta::RegisterMetadata(void)
+{
+    RegisterBaseTypes();
     Registerer::RegisterMetadata();
 }
 
+void Meta::RegisterMetadata(const std::size_t threadCount)
+{
+    RegisterBaseTypes();
+    Registerer::RegisterMetadata(threadCount);
+}
+
 #undef RegisterConverterHelper
 #undef RegisterType
\ No newline at end of file
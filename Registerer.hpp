@@ -5,6 +5,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #include <Kube/Core/TrivialDispatcher.hpp>
 
 #include "Meta.hpp"
@@ -21,19 +28,78 @@ namespace kF::Meta
 class kF::Meta::Registerer
 {
 public:
+    /** @brief Registration of a type, delayed until a lookup misses on it */
+    struct OnDemandRegistration
+    {
+        const std::type_info *typeInfo { nullptr };
+        HashedName name {};
+        bool done { false };
+        Core::TrivialFunctor<void(void)> functor;
+    };
+
     struct alignas_cacheline Cache
     {
         Core::Vector<Core::TrivialFunctor<void(void)>> types;
         Core::Vector<Core::TrivialFunctor<void(void)>> templates;
+
+        /* On demand registrations, recursive because a registration may look up other pending types */
+        std::recursive_mutex mutex;
+        std::atomic<std::size_t> pendingCount { 0u };
+        Core::Vector<OnDemandRegistration> onDemand;
+        Internal::HashIndex onDemandTypeIDIndex; // TypeID hash -> position in 'onDemand'
+        Internal::HashIndex onDemandNameIndex; // HashedName -> position in 'onDemand'
     };
 
-    /** @brief Register every type registered with 'RegisterLater' methods */
+    /** @brief Register every type registered with 'RegisterLater' methods, types registered with 'RegisterOnDemand' are deferred */
     static void RegisterMetadata(void)
     {
         for (auto &func : _Cache.types)
             func();
         for (auto &func : _Cache.templates)
             func();
+        if (!_Cache.onDemand.empty())
+            EnableOnDemandRegistration();
+    }
+
+    /**
+     * @brief Register every type registered with 'RegisterLater' methods, sharding their functors across 'threadCount' threads
+     *
+     * Template functors run once every type is registered, on the calling thread.
+     * Types registered with 'RegisterOnDemand' are deferred.
+     */
+    static void RegisterMetadata(const std::size_t threadCount)
+    {
+        RegisterParallel(_Cache.types.begin(), _Cache.types.end(), threadCount);
+        for (auto &func : _Cache.templates)
+            func();
+        if (!_Cache.onDemand.empty())
+            EnableOnDemandRegistration();
+    }
+
+    /**
+     * @brief Call a range of registration functors across 'threadCount' threads (the calling thread included)
+     *
+     * Each functor must only register its own type and the members of that type.
+     * Duplicate checks are deferred while functors run, then each newly registered type is validated in a single pass.
+     */
+    template<typename Iterator>
+    static void RegisterParallel(const Iterator begin, const Iterator end, const std::size_t threadCount)
+    {
+        const auto firstOrdinal = Resolver::OrdinalCount();
+
+        Type::DeferValidation(true);
+        try {
+            ParallelFor(static_cast<std::size_t>(std::distance(begin, end)), threadCount, [begin](const std::size_t index) {
+                (*(begin + index))();
+            });
+        } catch (...) {
+            Type::DeferValidation(false);
+            throw;
+        }
+        Type::DeferValidation(false);
+        ParallelFor(Resolver::OrdinalCount() - firstOrdinal, threadCount, [firstOrdinal](const std::size_t index) {
+            Resolver::FindType(static_cast<Type::Ordinal>(firstOrdinal + index)).validateMembers();
+        });
     }
 
     /** @brief Store a functor to be called at class registration time */
@@ -48,14 +114,155 @@ public:
             _Cache.templates.push(std::forward<Functor>(functor));
     }
 
+    /**
+     * @brief Store a functor to be called the first time a lookup misses on the type, either by ID or by name
+     *
+     * The functor runs once, it must register the type under 'name'.
+     * It runs from noexcept lookups: if it throws, the registration stays pending and the lookup misses.
+     */
+    template<typename Type, typename Functor>
+    static void RegisterOnDemand(const HashedName name, Functor &&functor)
+    {
+        std::lock_guard lock(_Cache.mutex);
+        const auto position = static_cast<Internal::HashIndex::Position>(_Cache.onDemand.size());
+
+        _Cache.onDemand.push(OnDemandRegistration {
+            typeInfo: &typeid(Type),
+            name: name,
+            done: false,
+            functor: std::forward<Functor>(functor)
+        });
+        _Cache.onDemandTypeIDIndex.insert(typeid(Type).hash_code(), position);
+        _Cache.onDemandNameIndex.insert(name, position);
+        _Cache.pendingCount.fetch_add(1u, std::memory_order_release);
+    }
+
+    /** @brief Make the resolver run on demand registrations when its lookups miss */
+    static void EnableOnDemandRegistration(void) noexcept
+        { Resolver::SetMissHandlers(&RegisterTypeIDOnDemand, &RegisterNameOnDemand, &PendingCount); }
+
+    /** @brief Run every pending on demand registration, must be called before sealing the resolver */
+    static void RegisterPendingMetadata(void)
+    {
+        std::lock_guard lock(_Cache.mutex);
+
+        for (auto i = 0u; i != _Cache.onDemand.size(); ++i)
+            static_cast<void>(Run(i));
+    }
+
+    /** @brief Get the number of on demand registrations that did not run yet */
+    [[nodiscard]] static std::size_t PendingCount(void) noexcept { return _Cache.pendingCount.load(std::memory_order_acquire); }
+
 private:
-    static inline Cache _Cache;
+    static Cache _Cache;
+
+    /** @brief Number of consecutive functors claimed at once by a registration thread */
+    static constexpr std::size_t ParallelBatchSize = 64u;
+
+    /** @brief Call 'functor' with each index in [0, count[ across 'threadCount' threads, rethrows the first exception */
+    template<typename Functor>
+    static void ParallelFor(const std::size_t count, const std::size_t threadCount, Functor &&functor)
+    {
+        std::atomic<std::size_t> next { 0u };
+        std::exception_ptr exception {};
+        std::mutex exceptionMutex;
+        const auto work = [count, &functor, &next, &exception, &exceptionMutex] {
+            try {
+                for (auto i = next.fetch_add(ParallelBatchSize, std::memory_order_relaxed); i < count; i = next.fetch_add(ParallelBatchSize, std::memory_order_relaxed)) {
+                    for (const auto last = std::min(i + ParallelBatchSize, count); i != last; ++i)
+                        functor(i);
+                }
+            } catch (...) {
+                std::lock_guard lock(exceptionMutex);
+                if (!exception)
+                    exception = std::current_exception();
+            }
+        };
+        const auto workerCount = std::min(threadCount, (count + ParallelBatchSize - 1u) / ParallelBatchSize);
+
+        if (workerCount > 1u) {
+            std::vector<std::jthread> workers;
+            workers.reserve(workerCount - 1u);
+            for (auto i = 1u; i != workerCount; ++i)
+                workers.emplace_back(work);
+            work();
+        } else
+            work();
+        if (exception) [[unlikely]]
+            std::rethrow_exception(exception);
+    }
+
+    /** @brief Miss handler of type IDs */
+    [[nodiscard]] static bool RegisterTypeIDOnDemand(const Type::TypeID id) noexcept
+    {
+        if (!PendingCount()) [[likely]]
+            return false;
+        std::lock_guard lock(_Cache.mutex);
+        const auto position = _Cache.onDemandTypeIDIndex.find(id.hash_code(), [id](const auto position) {
+            const auto &registration = _Cache.onDemand[position];
+            return !registration.done && Type::TypeID(*registration.typeInfo) == id;
+        });
+        return position != Internal::HashIndex::NullPosition && TryRun(position);
+    }
+
+    /** @brief Miss handler of type names */
+    [[nodiscard]] static bool RegisterNameOnDemand(const HashedName name) noexcept
+    {
+        if (!PendingCount()) [[likely]]
+            return false;
+        std::lock_guard lock(_Cache.mutex);
+        const auto position = _Cache.onDemandNameIndex.find(name, [](const auto position) {
+            return !_Cache.onDemand[position].done;
+        });
+        return position != Internal::HashIndex::NullPosition && TryRun(position);
+    }
+
+    /** @brief Run an on demand registration from a miss handler, returns false if its functor threw */
+    [[nodiscard]] static bool TryRun(const Internal::HashIndex::Position position) noexcept
+    {
+        try {
+            return Run(position);
+        } catch (...) {
+            return false;
+        }
+    }
+
+    /**
+     * @brief Run an on demand registration if not done yet, the mutex must be locked
+     *
+     * The registration is marked done before its functor runs so that a nested lookup doesn't run it again,
+     * it only stops being pending once the functor returned: lookups of other threads keep taking the mutex until then.
+     * If the functor throws, the registration is restored so that a later lookup retries it.
+     */
+    [[nodiscard]] static bool Run(const Internal::HashIndex::Position position)
+    {
+        auto &registration = _Cache.onDemand[position];
+
+        if (registration.done)
+            return false;
+        registration.done = true;
+        // The functor may push other registrations, invalidating 'registration'
+        auto functor = std::move(registration.functor);
+        try {
+            functor();
+        } catch (...) {
+            auto &failed = _Cache.onDemand[position];
+            failed.done = false;
+            failed.functor = std::move(functor);
+            throw;
+        }
+        _Cache.pendingCount.fetch_sub(1u, std::memory_order_release);
+        return true;
+    }
 
     /** @brief Registerer is a singleton */
     Registerer(void);
     ~Registerer(void);
 };
 
+/** @brief Defined out of the class, the cache default member initializers require the registerer to be complete */
+inline kF::Meta::Registerer::Cache kF::Meta::Registerer::_Cache {};
+
 /** @brief Helper used to register a class later in registerer */
 class kF::Meta::RegisterLater
 {
@@ -66,4 +273,11 @@ public:
         Registerer::RegisterLater<Type>(std::forward<Functor>(functor));
         return RegisterLater();
     }
-};
\ No newline at end of file
+
+    template<typename Type, typename Functor>
+    [[nodiscard]] static RegisterLater MakeOnDemand(const HashedName name, Functor &&functor) noexcept
+    {
+        Registerer::RegisterOnDemand<Type>(name, std::forward<Functor>(functor));
+        return RegisterLater();
+    }
+};
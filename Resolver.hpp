@@ -5,10 +5,19 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+
 #include <Kube/Core/Vector.hpp>
 #include <Kube/Core/FlatVector.hpp>
 
 #include "Type.hpp"
+#include "AppendVector.hpp"
+#include "HashIndex.hpp"
+#include "ConcurrentHashIndex.hpp"
+#include "PerfectHashIndex.hpp"
+#include "ConversionMatrix.hpp"
 
 /**
  * @brief Resolver is used to store and retreive meta-data at runtime
@@ -21,28 +30,102 @@ public:
     {
         HashedName name {};
         Core::FlatVector<Type> specializations;
+        Internal::HashIndex specializationIndex {}; // Specialization HashedName -> position in 'specializations'
     };
 
-    /** @brief Cache stored in static memory */
+    /** @brief Describe a flattened template specialization of a sealed resolver */
+    struct alignas_quarter_cacheline SealedSpecialization
+    {
+        HashedName name {};
+        HashedName specializationName {};
+        Type type {};
+    };
+
+    /** @brief Immutable tables built by 'Seal' (an empty index means its lookups fall back to the dynamic indexes) */
+    struct SealedTables
+    {
+        Core::Vector<SealedSpecialization> specializations;
+        Internal::PerfectHashIndex typeIDIndex; // TypeID hash -> position in 'Cache::types'
+        Internal::PerfectHashIndex typeNameIndex; // HashedName -> position in 'Cache::types'
+        Internal::PerfectHashIndex templateIndex; // HashedName -> position in 'Cache::templates'
+        Internal::PerfectHashIndex specializationIndex; // Combined HashedNames -> position in 'specializations'
+    };
+
+    /** @brief Handlers called when a type lookup misses, they return true if a pending registration ran */
+    using TypeIDMissHandler = bool(*)(const Type::TypeID id);
+    using NameMissHandler = bool(*)(const HashedName name);
+
+    /** @brief Handler returning the number of registrations that did not run yet */
+    using PendingHandler = std::size_t(*)(void);
+
+    /**
+     * @brief Cache stored in static memory
+     *
+     * Types can be registered by a thread while others resolve them: writers are serialized by 'mutex'
+     * and readers never block, types and their indexes are append-only and published atomically.
+     * Template registration is serialized the same way but must not run concurrently with template lookups.
+     */
     struct alignas_cacheline Cache
     {
-        Core::Vector<Type> types;
+        std::mutex mutex;
+        std::atomic<TypeIDMissHandler> typeIDMissHandler { nullptr };
+        std::atomic<NameMissHandler> nameMissHandler { nullptr };
+        std::atomic<PendingHandler> pendingHandler { nullptr };
+        Internal::AppendVector<Type> types;
+        Internal::AppendVector<Type> ordinals; // Ordinal -> registered type (including template specializations)
         Core::Vector<TemplateDescriptor> templates;
+        Internal::ConcurrentHashIndex typeIDIndex; // TypeID hash -> position in 'types'
+        Internal::ConcurrentHashIndex typeNameIndex; // HashedName -> position in 'types'
+        Internal::HashIndex templateIndex; // HashedName -> position in 'templates'
+        Internal::ConversionMatrix conversions; // (from, to) ordinals -> converter, rebuilt under 'mutex'
+        std::unique_ptr<SealedTables> sealedTables; // Owns the tables published by 'sealed', only accessed by writers
+        std::atomic<const SealedTables *> sealed { nullptr }; // Published once built, null until the resolver is sealed
     };
 
-    /** @brief Register a new type into the resolver */
+    /** @brief Register a new type into the resolver (thread safe) */
     static void RegisterMetaType(const Type type) noexcept_ndebug;
 
     /** @brief Register a new type into the resolver */
     static void RegisterMetaTemplateSpecialization(const HashedName name, const Type specialization) noexcept_ndebug;
 
 
-    /** @brief Resolve a type with its ID */
+    /** @brief Resolve a type with its ID (thread safe) */
     [[nodiscard]] static Type FindType(const Type::TypeID id) noexcept;
 
-    /** @brief Resolve a type with its name */
+    /** @brief Resolve a type with its name (thread safe) */
     [[nodiscard]] static Type FindType(const HashedName name) noexcept;
 
+    /** @brief Resolve a type with its ordinal (thread safe) */
+    [[nodiscard]] static Type FindType(const Type::Ordinal ordinal) noexcept;
+
+    /**
+     * @brief Set the handlers used to register types on demand, the first time a lookup misses on them (thread safe)
+     *
+     * A sealed resolver never calls them, so 'Seal' asserts that 'pendingHandler' (if any) reports no pending registration
+     */
+    static void SetMissHandlers(const TypeIDMissHandler typeIDHandler, const NameMissHandler nameHandler,
+            const PendingHandler pendingHandler = nullptr) noexcept;
+
+    /** @brief Run the pending registration of a type ID, returns true if one ran (thread safe) */
+    [[nodiscard]] static bool RegisterOnDemand(const Type::TypeID id) noexcept;
+
+    /** @brief Run the pending registration of a type name, returns true if one ran (thread safe) */
+    [[nodiscard]] static bool RegisterOnDemand(const HashedName name) noexcept;
+
+    /** @brief Get the number of ordinals assigned so far, every ordinal is lower than this count (thread safe) */
+    [[nodiscard]] static std::uint32_t OrdinalCount(void) noexcept { return _Cache.ordinals.size(); }
+
+
+    /**
+     * @brief Find the converter between two types using their ordinals
+     *
+     * The conversion matrix is rebuilt under the resolver lock on first lookup after a converter registration,
+     * the new matrix is published atomically so concurrent lookups keep reading the previous one.
+     * Pairs that the matrix doesn't index directly (no direct converter or a type registered after the build)
+     * are resolved under the lock on their first lookup, by searching the shortest chain of converters, and cached.
+     */
+    [[nodiscard]] static Converter FindConverter(const Type::Ordinal from, const Type::Ordinal to) noexcept;
+
 
     /** @brief Resolve a template type with its name */
     [[nodiscard]] static const TemplateDescriptor *FindTemplate(const HashedName name) noexcept;
@@ -54,12 +137,47 @@ public:
     [[nodiscard]] static Type FindTemplateSpecialization(const TemplateDescriptor *descriptor, const HashedName specializationName) noexcept;
 
 
-    /** @brief Clear all stored types */
+    /**
+     * @brief Seal the resolver once every meta-data is registered
+     *
+     * Sealing builds immutable perfect hashed tables so that each lookup is resolved with a single probe.
+     * Registering a type or a template specialization into a sealed resolver is an error, it is ignored in release builds.
+     * On demand registrations must have run before, as a sealed resolver never runs them.
+     * The tables are built aside and published atomically, so lookups may run while the resolver is sealed (thread safe).
+     */
+    static void Seal(void);
+
+    /**
+     * @brief Release the tables retired since the last call
+     *
+     * Registrations and conversion matrix builds keep replaced tables alive as concurrent lookups may still read them.
+     * Must be called while no lookup runs, for example once a plugin finished loading its types.
+     */
+    static void ReleaseRetired(void) noexcept;
+
+    /** @brief Check if the resolver is sealed */
+    [[nodiscard]] static bool IsSealed(void) noexcept { return _Cache.sealed.load(std::memory_order_acquire) != nullptr; }
+
+
+    /** @brief Clear all stored types (also unseal the resolver), must not run concurrently with any other function */
     static void Clear(void) noexcept;
 
 private:
-    static inline Cache _Cache {};
+    static Cache _Cache;
+
+    /** @brief Build the sealed tables from registered types, the resolver must be locked */
+    [[nodiscard]] static std::unique_ptr<SealedTables> BuildSealedTables(void);
+
+    /** @brief Find a registered type in the mutable indexes, never runs on demand registrations (thread safe) */
+    [[nodiscard]] static Type ProbeType(const Type::TypeID id) noexcept;
+    [[nodiscard]] static Type ProbeType(const HashedName name) noexcept;
+
+    /** @brief Assign the next ordinal to a type, the resolver must be locked */
+    static void AssignOrdinal(const Type type);
 
     /** @brief Resolver is a singleton */
     Resolver(void) = delete;
-};
\ No newline at end of file
+};
+
+/** @brief Defined out of the class, the cache default member initializers require the resolver to be complete */
+inline kF::Meta::Resolver::Cache kF::Meta::Resolver::_Cache {};
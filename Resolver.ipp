@@ -5,49 +5,172 @@
 
 inline void kF::Meta::Resolver::RegisterMetaType(const Type type) noexcept_ndebug
 {
-    kFAssert(!FindType(type.typeID()).operator bool(),
+    std::lock_guard lock(_Cache.mutex);
+
+    kFAssert(!IsSealed(),
+        throw std::logic_error("Meta::Resolver::RegisterMetaType: Resolver is sealed"));
+    // Sealed tables are immutable, a type registered after sealing would be missed by their lookups
+    if (IsSealed()) [[unlikely]]
+        return;
+    // FindType would run on demand registrations while the resolver is locked, the index is probed instead
+    kFAssert(!ProbeType(type.typeID()).operator bool(),
         throw std::logic_error("Meta::Resolver::RegisterMetaTypeDescriptor: Type already registered"));
+    const auto position = static_cast<Internal::HashIndex::Position>(_Cache.types.size());
+
+    // The type must be published before being indexed
+    AssignOrdinal(type);
     _Cache.types.push(type);
+    _Cache.typeIDIndex.insert(type.typeID().hash_code(), position);
+    _Cache.typeNameIndex.insert(type.name(), position);
 }
 
 inline void kF::Meta::Resolver::RegisterMetaTemplateSpecialization(const HashedName name, const Type specialization) noexcept_ndebug
 {
-    if (const auto descriptor = const_cast<TemplateDescriptor *>(FindTemplate(name)); descriptor)
-        descriptor->specializations.push(specialization);
-    else
-        _Cache.templates.push(TemplateDescriptor {
-            name: name,
-            specializations: { specialization }
-        });
+    std::lock_guard lock(_Cache.mutex);
+
+    kFAssert(!IsSealed(),
+        throw std::logic_error("Meta::Resolver::RegisterMetaTemplateSpecialization: Resolver is sealed"));
+    // Sealed tables are immutable, a type registered after sealing would be missed by their lookups
+    if (IsSealed()) [[unlikely]]
+        return;
+    auto descriptor = const_cast<TemplateDescriptor *>(FindTemplate(name));
+
+    AssignOrdinal(specialization);
+    if (!descriptor) {
+        const auto position = static_cast<Internal::HashIndex::Position>(_Cache.templates.size());
+        _Cache.templates.push(TemplateDescriptor { name: name });
+        _Cache.templateIndex.insert(name, position);
+        descriptor = &_Cache.templates[position];
+    }
+    descriptor->specializationIndex.insert(specialization.name(), static_cast<Internal::HashIndex::Position>(descriptor->specializations.size()));
+    descriptor->specializations.push(specialization);
 }
 
 inline kF::Meta::Type kF::Meta::Resolver::FindType(const Type::TypeID id) noexcept
 {
-    for (const auto type : _Cache.types)
-        if (type.typeID() == id) [[unlikely]]
-            return type;
-    return Type();
+    if (const auto sealed = _Cache.sealed.load(std::memory_order_acquire); sealed && sealed->typeIDIndex.size()) [[likely]] {
+        const auto position = sealed->typeIDIndex.find(id.hash_code());
+        if (position != Internal::PerfectHashIndex::NullPosition && _Cache.types[position].typeID() == id) [[likely]]
+            return _Cache.types[position];
+        return Type();
+    }
+    if (const auto type = ProbeType(id); type) [[likely]]
+        return type;
+    // Another thread may have registered the type while the handler waited for it, the index is probed again in any case
+    static_cast<void>(RegisterOnDemand(id));
+    return ProbeType(id);
 }
 
 inline kF::Meta::Type kF::Meta::Resolver::FindType(const HashedName name) noexcept
 {
-    for (const auto type : _Cache.types)
-        if (type.name() == name) [[unlikely]]
-            return type;
+    if (const auto sealed = _Cache.sealed.load(std::memory_order_acquire); sealed && sealed->typeNameIndex.size()) [[likely]] {
+        const auto position = sealed->typeNameIndex.find(name);
+        if (position != Internal::PerfectHashIndex::NullPosition) [[likely]]
+            return _Cache.types[position];
+        return Type();
+    }
+    if (const auto type = ProbeType(name); type) [[likely]]
+        return type;
+    // Another thread may have registered the type while the handler waited for it, the index is probed again in any case
+    static_cast<void>(RegisterOnDemand(name));
+    return ProbeType(name);
+}
+
+inline void kF::Meta::Resolver::SetMissHandlers(const TypeIDMissHandler typeIDHandler, const NameMissHandler nameHandler,
+        const PendingHandler pendingHandler) noexcept
+{
+    _Cache.typeIDMissHandler.store(typeIDHandler, std::memory_order_release);
+    _Cache.nameMissHandler.store(nameHandler, std::memory_order_release);
+    _Cache.pendingHandler.store(pendingHandler, std::memory_order_release);
+}
+
+inline bool kF::Meta::Resolver::RegisterOnDemand(const Type::TypeID id) noexcept
+{
+    const auto handler = _Cache.typeIDMissHandler.load(std::memory_order_acquire);
+
+    return handler && !IsSealed() && (*handler)(id);
+}
+
+inline bool kF::Meta::Resolver::RegisterOnDemand(const HashedName name) noexcept
+{
+    const auto handler = _Cache.nameMissHandler.load(std::memory_order_acquire);
+
+    return handler && !IsSealed() && (*handler)(name);
+}
+
+inline kF::Meta::Type kF::Meta::Resolver::ProbeType(const Type::TypeID id) noexcept
+{
+    const auto position = _Cache.typeIDIndex.find(id.hash_code(), [id](const auto position) {
+        return _Cache.types[position].typeID() == id;
+    });
+
+    if (position != Internal::HashIndex::NullPosition) [[likely]]
+        return _Cache.types[position];
+    return Type();
+}
+
+inline kF::Meta::Type kF::Meta::Resolver::ProbeType(const HashedName name) noexcept
+{
+    const auto position = _Cache.typeNameIndex.find(name);
+
+    if (position != Internal::HashIndex::NullPosition) [[likely]]
+        return _Cache.types[position];
+    return Type();
+}
+
+inline kF::Meta::Type kF::Meta::Resolver::FindType(const Type::Ordinal ordinal) noexcept
+{
+    const auto index = static_cast<std::uint32_t>(ordinal);
+
+    if (index < _Cache.ordinals.size()) [[likely]]
+        return _Cache.ordinals[index];
     return Type();
 }
 
+inline kF::Meta::Converter kF::Meta::Resolver::FindConverter(const Type::Ordinal from, const Type::Ordinal to) noexcept
+{
+    // The published matrix is read without locking, it is only built under the resolver lock
+    if (_Cache.conversions.generation() != Type::ConvertersGeneration()) [[unlikely]] {
+        std::lock_guard lock(_Cache.mutex);
+        const auto generation = Type::ConvertersGeneration();
+        if (_Cache.conversions.generation() != generation)
+            _Cache.conversions.build(_Cache.ordinals, generation);
+    }
+    Converter converter;
+
+    if (_Cache.conversions.find(from, to, converter)) [[likely]]
+        return converter;
+    // Pairs without direct converter are resolved once per matrix build
+    std::lock_guard lock(_Cache.mutex);
+    return _Cache.conversions.resolve(FindType(from), FindType(to));
+}
+
 inline const kF::Meta::Resolver::TemplateDescriptor *kF::Meta::Resolver::FindTemplate(const HashedName name) noexcept
 {
-    for (const auto &descriptor : _Cache.templates) {
-        if (descriptor.name == name) [[unlikely]]
-            return &descriptor;
+    if (const auto sealed = _Cache.sealed.load(std::memory_order_acquire); sealed && sealed->templateIndex.size()) [[likely]] {
+        const auto position = sealed->templateIndex.find(name);
+        if (position != Internal::PerfectHashIndex::NullPosition) [[likely]]
+            return &_Cache.templates[position];
+        return nullptr;
     }
+    const auto position = _Cache.templateIndex.find(name);
+
+    if (position != Internal::HashIndex::NullPosition) [[likely]]
+        return &_Cache.templates[position];
     return nullptr;
 }
 
 inline kF::Meta::Type kF::Meta::Resolver::FindTemplateSpecialization(const HashedName name, const HashedName specializationName) noexcept
 {
+    if (const auto sealed = _Cache.sealed.load(std::memory_order_acquire); sealed && sealed->specializationIndex.size()) [[likely]] {
+        const auto position = sealed->specializationIndex.find(Internal::HashIndex::Combine(name, specializationName));
+        if (position == Internal::PerfectHashIndex::NullPosition) [[unlikely]]
+            return Type();
+        const auto &specialization = sealed->specializations[position];
+        if (specialization.name == name && specialization.specializationName == specializationName) [[likely]]
+            return specialization.type;
+        return Type();
+    }
     const auto descriptor = FindTemplate(name);
     if (!descriptor)
         return Type();
@@ -56,22 +179,109 @@ inline kF::Meta::Type kF::Meta::Resolver::FindTemplateSpecialization(const Hashe
 
 inline kF::Meta::Type kF::Meta::Resolver::FindTemplateSpecialization(const TemplateDescriptor *descriptor, const HashedName specializationName) noexcept
 {
-    for (const auto &type : descriptor->specializations) {
-        if (type.name() == specializationName) [[unlikely]]
-            return type;
-    }
+    if (const auto sealed = _Cache.sealed.load(std::memory_order_acquire); sealed && sealed->specializationIndex.size()) [[likely]]
+        return FindTemplateSpecialization(descriptor->name, specializationName);
+    const auto position = descriptor->specializationIndex.find(specializationName);
+
+    if (position != Internal::HashIndex::NullPosition) [[likely]]
+        return descriptor->specializations[position];
     return Type();
 }
 
+inline void kF::Meta::Resolver::Seal(void)
+{
+    using Position = Internal::PerfectHashIndex::Position;
+
+    std::lock_guard lock(_Cache.mutex);
+
+    kFAssert(!IsSealed(),
+        throw std::logic_error("Meta::Resolver::Seal: Resolver already sealed"));
+    // A pending registration would never run once sealed, its type lookups would miss
+    [[maybe_unused]] const auto pendingHandler = _Cache.pendingHandler.load(std::memory_order_acquire);
+    kFAssert(!pendingHandler || !(*pendingHandler)(),
+        throw std::logic_error("Meta::Resolver::Seal: On demand registrations are pending, run them with 'Registerer::RegisterPendingMetadata' first"));
+    // Flatten every registered type so that lookups of a sealed resolver never modify descriptors
+    for (Position i = 0u; i != _Cache.ordinals.size(); ++i)
+        _Cache.ordinals[i].flatten();
+    _Cache.conversions.build(_Cache.ordinals, Type::ConvertersGeneration());
+    // Lookups keep using the dynamic indexes until the sealed tables are published
+    _Cache.sealedTables = BuildSealedTables();
+    _Cache.sealed.store(_Cache.sealedTables.get(), std::memory_order_release);
+}
+
+inline std::unique_ptr<kF::Meta::Resolver::SealedTables> kF::Meta::Resolver::BuildSealedTables(void)
+{
+    using Position = Internal::PerfectHashIndex::Position;
+
+    auto tables = std::make_unique<SealedTables>();
+    Core::Vector<Internal::PerfectHashIndex::Slot> entries;
+
+    // Each table is built independently, if one fails (colliding keys) its lookups keep using the dynamic path
+    for (Position i = 0u; i != _Cache.types.size(); ++i)
+        entries.push({ _Cache.types[i].typeID().hash_code(), i });
+    tables->typeIDIndex.build(entries);
+    entries.clear();
+    // Only the first type of a given name is indexed, as the dynamic path does
+    for (Position i = 0u; i != _Cache.types.size(); ++i)
+        if (const auto name = _Cache.types[i].name(); _Cache.typeNameIndex.find(name) == i)
+            entries.push({ name, i });
+    tables->typeNameIndex.build(entries);
+    entries.clear();
+    for (Position i = 0u; i != _Cache.templates.size(); ++i)
+        entries.push({ _Cache.templates[i].name, i });
+    tables->templateIndex.build(entries);
+    entries.clear();
+    for (const auto &descriptor : _Cache.templates) {
+        for (const auto type : descriptor.specializations) {
+            if (FindTemplateSpecialization(&descriptor, type.name()) != type) [[unlikely]]
+                continue;
+            entries.push({ Internal::HashIndex::Combine(descriptor.name, type.name()), static_cast<Position>(tables->specializations.size()) });
+            tables->specializations.push(SealedSpecialization {
+                name: descriptor.name,
+                specializationName: type.name(),
+                type: type
+            });
+        }
+    }
+    tables->specializationIndex.build(entries);
+    return tables;
+}
+
+inline void kF::Meta::Resolver::ReleaseRetired(void) noexcept
+{
+    std::lock_guard lock(_Cache.mutex);
+
+    for (auto i = 0u, count = _Cache.ordinals.size(); i != count; ++i)
+        _Cache.ordinals[i].releaseRetired();
+    _Cache.conversions.releaseRetired();
+    _Cache.typeIDIndex.releaseRetired();
+    _Cache.typeNameIndex.releaseRetired();
+}
+
+inline void kF::Meta::Resolver::AssignOrdinal(const Type type)
+{
+    type.setOrdinal(static_cast<Type::Ordinal>(_Cache.ordinals.size()));
+    _Cache.ordinals.push(type);
+}
+
 inline void kF::Meta::Resolver::Clear(void) noexcept
 {
-    for (auto &descriptor : _Cache.types) {
-        descriptor.clear();
+    for (auto i = 0u, count = _Cache.types.size(); i != count; ++i) {
+        _Cache.types[i].clear();
     }
     for (auto &descriptor : _Cache.templates) {
         for (auto &specialization : descriptor.specializations)
             specialization.clear();
     }
     _Cache.types.clear();
+    _Cache.ordinals.clear();
     _Cache.templates.clear();
-}
\ No newline at end of file
+    _Cache.typeIDIndex.clear();
+    _Cache.typeNameIndex.clear();
+    _Cache.templateIndex.clear();
+    _Cache.conversions.clear();
+    _Cache.sealed.store(nullptr, std::memory_order_release);
+    _Cache.sealedTables.reset();
+    Type::InvalidateMembers();
+    Type::InvalidateConverters();
+}
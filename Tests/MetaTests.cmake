@@ -7,6 +7,7 @@ set(KubeMetaTestsSources
     ${KubeMetaTestsDir}/tests_Constructor.cpp
     ${KubeMetaTestsDir}/tests_Converter.cpp
     ${KubeMetaTestsDir}/tests_Data.cpp
+    ${KubeMetaTestsDir}/tests_Resolver.cpp
     ${KubeMetaTestsDir}/tests_Type.cpp
     ${KubeMetaTestsDir}/tests_Var.cpp
     ${KubeMetaTestsDir}/tests_Signal.cpp
@@ -101,4 +101,94 @@ TEST(Constructor, AdvancedConstructor)
     ASSERT_EQ(instance.as<Foo>().x, 42);
     ASSERT_EQ(instance.as<Foo>().y, "azerty");
     ASSERT_EQ(instance.as<Foo>().z, 32.0f);
-}
\ No newline at end of file
+}
+
+TEST(Constructor, ResolutionCache)
+{
+    struct Foo
+    {
+        Foo(int x_, double y_) : x(x_), y(y_) {}
+        Foo(int x_) : x(x_), y(0.0) {}
+
+        int x;
+        double y;
+    };
+
+    Meta::Resolver::Clear();
+    Meta::RegisterMetadata();
+    Meta::Factory<Foo>::Register("foo"_hash);
+    Meta::Factory<Foo>::RegisterConstructor<int, double>();
+    auto type = Meta::Factory<Foo>::Resolve();
+    const Meta::Type args[] { Meta::Factory<float>::Resolve(), Meta::Factory<double>::Resolve() };
+
+    auto match = type.resolveConstructor(args, 2);
+    ASSERT_TRUE(match.constructor);
+    ASSERT_FALSE(match.isExact);
+    ASSERT_TRUE(match.converters);
+    ASSERT_EQ(match.converters[0].convertType(), Meta::Factory<int>::Resolve());
+    ASSERT_FALSE(match.converters[1]);
+    ASSERT_EQ(match.converters, type.resolveConstructor(args, 2).converters);
+    ASSERT_EQ(match.constructor, type.resolveConstructor(args, 2).constructor);
+    ASSERT_FALSE(type.resolveConstructor(args, 1).constructor);
+    Meta::Factory<Foo>::RegisterConstructor<int>();
+    match = type.resolveConstructor(args, 1);
+    ASSERT_TRUE(match.constructor);
+    ASSERT_EQ(match.constructor.argsCount(), 1u);
+    const Meta::Type exactArgs[] { Meta::Factory<int>::Resolve(), Meta::Factory<double>::Resolve() };
+    ASSERT_TRUE(type.resolveConstructor(exactArgs, 2).isExact);
+}
+
+TEST(Constructor, VarConstruct)
+{
+    struct Foo
+    {
+        Foo(int x_, const std::string &y_, std::unique_ptr<int> &&z_) : x(x_), y(y_), z(std::move(z_)) {}
+
+        int x;
+        std::string y;
+        std::unique_ptr<int> z;
+    };
+
+    Meta::Resolver::Clear();
+    Meta::RegisterMetadata();
+    Meta::Factory<Foo>::Register("foo"_hash);
+    Meta::Factory<Foo>::RegisterConstructor<int, const std::string &, std::unique_ptr<int> &&>();
+
+    const std::string y("azerty");
+    auto z = std::make_unique<int>(24);
+    Var instance = Var::Construct("foo"_hash, 42, y, std::move(z));
+    ASSERT_EQ(instance.type(), Meta::Factory<Foo>::Resolve());
+    ASSERT_EQ(instance.as<Foo>().x, 42);
+    ASSERT_EQ(instance.as<Foo>().y, "azerty");
+    ASSERT_EQ(*instance.as<Foo>().z, 24);
+    ASSERT_FALSE(z);
+    ASSERT_EQ(y, "azerty");
+
+    // Arguments requiring a conversion use the converters resolved with the match
+    instance = Var::Construct("foo"_hash, 42.0, y, std::make_unique<int>(12));
+    ASSERT_EQ(instance.as<Foo>().x, 42);
+    ASSERT_EQ(*instance.as<Foo>().z, 12);
+}
+
+TEST(Constructor, VarConstructRValueParameter)
+{
+    struct Bar
+    {
+        Bar(std::string &&s_) : s(std::move(s_)) {}
+
+        std::string s;
+    };
+
+    Meta::Resolver::Clear();
+    Meta::RegisterMetadata();
+    Meta::Factory<Bar>::Register("bar"_hash);
+    Meta::Factory<Bar>::RegisterConstructor<std::string &&>();
+
+    // An lvalue bound to a rvalue reference parameter is copied, only temporaries are moved from
+    std::string s("0123456789ABCDEFGHIJ");
+    Var instance = Var::Construct("bar"_hash, s);
+    ASSERT_EQ(instance.as<Bar>().s, "0123456789ABCDEFGHIJ");
+    ASSERT_EQ(s, "0123456789ABCDEFGHIJ");
+    instance = Var::Construct("bar"_hash, std::move(s));
+    ASSERT_EQ(instance.as<Bar>().s, "0123456789ABCDEFGHIJ");
+}
@@ -53,3 +53,30 @@ CONVERTER_TEST(IntToStringLambda,
     std::string, "42",
     [](auto x) { return std::to_string(x); }
 )
+
+TEST(Converter, Composite)
+{
+    Meta::Resolver::Clear();
+    Meta::Factory<int>::Register("int"_hash);
+    Meta::Factory<double>::Register("double"_hash);
+    Meta::Factory<std::string>::Register("string"_hash);
+    Meta::Factory<int>::RegisterConverter<double>();
+    Meta::Factory<double>::RegisterConverter<std::string, [](const double x) { return std::to_string(x); }>();
+    auto conv = Meta::Factory<int>::Resolve().findConverter(Meta::Factory<std::string>::Resolve());
+    ASSERT_TRUE(conv);
+    ASSERT_TRUE(conv.isComposite());
+    ASSERT_EQ(conv.convertType(), Meta::Factory<std::string>::Resolve());
+    ASSERT_EQ(conv, Meta::Factory<int>::Resolve().findConverter(Meta::Factory<std::string>::Resolve()));
+    // Rebuilding the matrix reuses the composite converters already resolved
+    Meta::Factory<float>::Register("float"_hash);
+    Meta::Factory<float>::RegisterConverter<int>();
+    ASSERT_EQ(conv, Meta::Factory<int>::Resolve().findConverter(Meta::Factory<std::string>::Resolve()));
+    Var x { 42 };
+    ASSERT_EQ(conv.invoke(x).as<std::string>(), std::to_string(42.0));
+    ASSERT_FALSE(Meta::Factory<std::string>::Resolve().findConverter(Meta::Factory<int>::Resolve()));
+    // A direct converter registered later takes precedence
+    Meta::Factory<int>::RegisterConverter<std::string, [](const int x) { return std::to_string(x); }>();
+    conv = Meta::Factory<int>::Resolve().findConverter(Meta::Factory<std::string>::Resolve());
+    ASSERT_FALSE(conv.isComposite());
+    ASSERT_EQ(conv.invoke(x).as<std::string>(), "42");
+}
@@ -8,7 +8,58 @@
 #include <Kube/Meta/Meta.hpp>
 
 using namespace kF;
+using namespace kF::Literal;
 
 TEST(Factory, Basics)
 {
+}
+
+struct BatchBase { static int Foo(void) { return 1; } };
+struct BatchDerived : BatchBase
+{
+    static int Bar(void) { return 2; }
+    static int Baz(void) { return 3; }
+
+    int value { 0 };
+
+    int getValue(void) const noexcept { return value; }
+    void setValue(const int value_) noexcept { value = value_; }
+};
+
+TEST(Factory, Batch)
+{
+    auto base = Meta::Factory<BatchBase>::Resolve();
+    auto derived = Meta::Factory<BatchDerived>::Resolve();
+
+    Meta::Factory<BatchBase>::RegisterFunction<&BatchBase::Foo>("foo"_hash);
+    Meta::Factory<BatchDerived>::Batch()
+        .base<BatchBase>()
+        .function<&BatchDerived::Bar>("bar"_hash)
+        .function<&BatchDerived::Baz>("baz"_hash)
+        .data<&BatchDerived::getValue, &BatchDerived::setValue>("value"_hash)
+        .commit();
+    ASSERT_EQ(derived.findBase(base), base);
+    ASSERT_EQ(derived.findFunction("foo"_hash).invoke().as<int>(), 1);
+    ASSERT_EQ(derived.findFunction("bar"_hash).invoke().as<int>(), 2);
+    ASSERT_EQ(derived.findFunction("baz"_hash).invoke().as<int>(), 3);
+    ASSERT_TRUE(derived.findData("value"_hash));
+    derived.clear();
+    base.clear();
+    ASSERT_FALSE(derived.findFunction("bar"_hash));
+}
+
+TEST(Factory, BatchCommitTwice)
+{
+    auto base = Meta::Factory<BatchBase>::Resolve();
+    auto derived = Meta::Factory<BatchDerived>::Resolve();
+    auto builder = Meta::Factory<BatchDerived>::Batch();
+
+    // Each commit empties the builder, members committed before are not registered again
+    builder.base<BatchBase>().function<&BatchDerived::Bar>("bar"_hash).commit();
+    builder.function<&BatchDerived::Baz>("baz"_hash).commit();
+    ASSERT_EQ(derived.findBase(base), base);
+    ASSERT_EQ(derived.cold().bases.size(), 1u);
+    ASSERT_EQ(derived.findFunction("bar"_hash).invoke().as<int>(), 2);
+    ASSERT_EQ(derived.findFunction("baz"_hash).invoke().as<int>(), 3);
+    derived.clear();
 }
\ No newline at end of file
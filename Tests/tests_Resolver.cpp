@@ -1,12 +1,361 @@
 /**
  * @ Author: Matthieu Moinvaziri
- * @ Description: Unit tests of Application
+ * @ Description: Unit tests of Resolver
  */
 
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
-// #include <Kube/Graphics/Renderer.hpp>
+#include <Kube/Meta/Meta.hpp>
+#include <Kube/Meta/Registerer.hpp>
+
+using namespace kF;
+using namespace kF::Literal;
+
+template<std::size_t Index>
+struct ResolverType {};
+
+template<std::size_t ...Indexes>
+static void RegisterResolverTypes(std::index_sequence<Indexes...>)
+{
+    (Meta::Factory<ResolverType<Indexes>>::Register(static_cast<HashedName>(Indexes + 1)), ...);
+}
+
+template<std::size_t ...Indexes>
+static bool CheckResolverTypes(std::index_sequence<Indexes...>)
+{
+    return ((Meta::Resolver::FindType(static_cast<HashedName>(Indexes + 1)) == Meta::Factory<ResolverType<Indexes>>::Resolve()) && ...)
+        && ((Meta::Resolver::FindType(typeid(ResolverType<Indexes>)) == Meta::Factory<ResolverType<Indexes>>::Resolve()) && ...);
+}
+
+TEST(Resolver, FindType)
+{
+    constexpr auto Sequence = std::make_index_sequence<100>();
+
+    Meta::Resolver::Clear();
+    ASSERT_FALSE(Meta::Resolver::FindType("int"_hash));
+    ASSERT_FALSE(Meta::Resolver::FindType(typeid(int)));
+    Meta::Factory<int>::Register("int"_hash);
+    ASSERT_EQ(Meta::Resolver::FindType("int"_hash), Meta::Factory<int>::Resolve());
+    ASSERT_EQ(Meta::Resolver::FindType(typeid(int)), Meta::Factory<int>::Resolve());
+    RegisterResolverTypes(Sequence);
+    ASSERT_TRUE(CheckResolverTypes(Sequence));
+    ASSERT_EQ(Meta::Resolver::FindType("int"_hash), Meta::Factory<int>::Resolve());
+    ASSERT_FALSE(Meta::Resolver::FindType("unknown"_hash));
+    ASSERT_FALSE(Meta::Resolver::FindType(typeid(float)));
+    Meta::Resolver::Clear();
+    ASSERT_FALSE(Meta::Resolver::FindType("int"_hash));
+    ASSERT_FALSE(Meta::Resolver::FindType(static_cast<HashedName>(1)));
+}
+
+template<typename Type>
+struct ResolverTemplate {};
+
+TEST(Resolver, Seal)
+{
+    constexpr auto Sequence = std::make_index_sequence<100>();
+
+    Meta::Resolver::Clear();
+    Meta::Factory<int>::Register("int"_hash);
+    Meta::Factory<ResolverTemplate<int>>::Register("ResolverTemplate"_hash, "ResolverTemplate<int>"_hash);
+    Meta::Factory<ResolverTemplate<float>>::Register("ResolverTemplate"_hash, "ResolverTemplate<float>"_hash);
+    RegisterResolverTypes(Sequence);
+    ASSERT_FALSE(Meta::Resolver::IsSealed());
+    Meta::Resolver::Seal();
+    ASSERT_TRUE(Meta::Resolver::IsSealed());
+    ASSERT_TRUE(CheckResolverTypes(Sequence));
+    ASSERT_EQ(Meta::Resolver::FindType("int"_hash), Meta::Factory<int>::Resolve());
+    ASSERT_EQ(Meta::Resolver::FindType(typeid(int)), Meta::Factory<int>::Resolve());
+    ASSERT_FALSE(Meta::Resolver::FindType("unknown"_hash));
+    ASSERT_FALSE(Meta::Resolver::FindType(typeid(float)));
+    ASSERT_TRUE(Meta::Resolver::FindTemplate("ResolverTemplate"_hash));
+    ASSERT_FALSE(Meta::Resolver::FindTemplate("unknown"_hash));
+    ASSERT_EQ(Meta::Resolver::FindTemplateSpecialization("ResolverTemplate"_hash, "ResolverTemplate<int>"_hash), Meta::Factory<ResolverTemplate<int>>::Resolve());
+    ASSERT_EQ(Meta::Resolver::FindTemplateSpecialization("ResolverTemplate"_hash, "ResolverTemplate<float>"_hash), Meta::Factory<ResolverTemplate<float>>::Resolve());
+    ASSERT_FALSE(Meta::Resolver::FindTemplateSpecialization("ResolverTemplate"_hash, "ResolverTemplate<double>"_hash));
+    Meta::Resolver::Clear();
+    ASSERT_FALSE(Meta::Resolver::IsSealed());
+    ASSERT_FALSE(Meta::Resolver::FindType("int"_hash));
+    ASSERT_FALSE(Meta::Resolver::FindTemplate("ResolverTemplate"_hash));
+}
+
+template<std::size_t Index>
+struct ResolverSpecialization {};
+
+template<std::size_t ...Indexes>
+static void RegisterResolverSpecializations(std::index_sequence<Indexes...>)
+{
+    (Meta::Factory<ResolverSpecialization<Indexes>>::Register(static_cast<HashedName>(Indexes % 10 + 1), static_cast<HashedName>(Indexes + 101)), ...);
+}
+
+template<std::size_t ...Indexes>
+static bool CheckResolverSpecializations(std::index_sequence<Indexes...>)
+{
+    return ((Meta::Resolver::FindTemplateSpecialization(static_cast<HashedName>(Indexes % 10 + 1), static_cast<HashedName>(Indexes + 101))
+            == Meta::Factory<ResolverSpecialization<Indexes>>::Resolve()) && ...);
+}
+
+TEST(Resolver, FindTemplateSpecialization)
+{
+    constexpr auto Sequence = std::make_index_sequence<100>();
+
+    Meta::Resolver::Clear();
+    RegisterResolverSpecializations(Sequence);
+    ASSERT_TRUE(CheckResolverSpecializations(Sequence));
+    for (auto i = 1u; i <= 10u; ++i) {
+        const auto descriptor = Meta::Resolver::FindTemplate(static_cast<HashedName>(i));
+        ASSERT_TRUE(descriptor);
+        ASSERT_EQ(descriptor->specializations.size(), 10u);
+    }
+    ASSERT_FALSE(Meta::Resolver::FindTemplate(static_cast<HashedName>(11)));
+    ASSERT_FALSE(Meta::Resolver::FindTemplateSpecialization(static_cast<HashedName>(1), static_cast<HashedName>(102)));
+    Meta::Resolver::Clear();
+    ASSERT_FALSE(Meta::Resolver::FindTemplate(static_cast<HashedName>(1)));
+}
+
+TEST(Resolver, ConcurrentFindType)
+{
+    constexpr auto Sequence = std::make_index_sequence<100>();
+    constexpr auto ReaderCount = 4;
+
+    std::atomic<bool> running { true };
+    std::atomic<std::size_t> errors { 0 };
+    std::vector<std::thread> readers;
+
+    Meta::Resolver::Clear();
+    for (auto i = 0; i < ReaderCount; ++i) {
+        readers.emplace_back([&running, &errors] {
+            while (running.load()) {
+                for (auto index = 1u; index <= 100u; ++index) {
+                    const auto type = Meta::Resolver::FindType(static_cast<HashedName>(index));
+                    if (type && type.name() != static_cast<HashedName>(index))
+                        ++errors;
+                }
+            }
+        });
+    }
+    RegisterResolverTypes(Sequence);
+    running = false;
+    for (auto &reader : readers)
+        reader.join();
+    ASSERT_EQ(errors.load(), 0u);
+    ASSERT_TRUE(CheckResolverTypes(Sequence));
+    Meta::Resolver::Clear();
+}
+
+TEST(Resolver, ConcurrentSeal)
+{
+    constexpr auto Sequence = std::make_index_sequence<100>();
+    constexpr auto ReaderCount = 4;
+
+    std::atomic<bool> running { true };
+    std::atomic<std::size_t> errors { 0 };
+    std::vector<std::thread> readers;
+
+    Meta::Resolver::Clear();
+    RegisterResolverTypes(Sequence);
+    for (auto i = 0; i < ReaderCount; ++i) {
+        readers.emplace_back([&running, &errors] {
+            // Lookups switch to the sealed tables once they are published, they must resolve every type in both cases
+            while (running.load()) {
+                for (auto index = 1u; index <= 100u; ++index) {
+                    const auto type = Meta::Resolver::FindType(static_cast<HashedName>(index));
+                    if (!type || type.name() != static_cast<HashedName>(index))
+                        ++errors;
+                }
+            }
+        });
+    }
+    Meta::Resolver::Seal();
+    running = false;
+    for (auto &reader : readers)
+        reader.join();
+    ASSERT_EQ(errors.load(), 0u);
+    ASSERT_TRUE(Meta::Resolver::IsSealed());
+    ASSERT_TRUE(CheckResolverTypes(Sequence));
+    Meta::Resolver::Clear();
+}
+
+TEST(Resolver, Ordinal)
+{
+    constexpr auto Sequence = std::make_index_sequence<100>();
+
+    Meta::Resolver::Clear();
+    ASSERT_EQ(Meta::Resolver::OrdinalCount(), 0u);
+    ASSERT_EQ(Meta::Factory<int>::Resolve().ordinal(), Meta::Type::Ordinal::Null);
+    ASSERT_FALSE(Meta::Resolver::FindType(Meta::Type::Ordinal::Null));
+    Meta::Factory<int>::Register("int"_hash);
+    Meta::Factory<ResolverTemplate<int>>::Register("ResolverTemplate"_hash, "ResolverTemplate<int>"_hash);
+    RegisterResolverTypes(Sequence);
+    ASSERT_EQ(Meta::Resolver::OrdinalCount(), 102u);
+    ASSERT_EQ(Meta::Factory<int>::Resolve().ordinal(), static_cast<Meta::Type::Ordinal>(0));
+    ASSERT_EQ(Meta::Factory<ResolverTemplate<int>>::Resolve().ordinal(), static_cast<Meta::Type::Ordinal>(1));
+    for (auto i = 0u; i < Meta::Resolver::OrdinalCount(); ++i) {
+        const auto ordinal = static_cast<Meta::Type::Ordinal>(i);
+        ASSERT_EQ(Meta::Resolver::FindType(ordinal).ordinal(), ordinal);
+    }
+    ASSERT_FALSE(Meta::Resolver::FindType(static_cast<Meta::Type::Ordinal>(102)));
+    Meta::Resolver::Clear();
+    ASSERT_EQ(Meta::Resolver::OrdinalCount(), 0u);
+    ASSERT_EQ(Meta::Factory<int>::Resolve().ordinal(), Meta::Type::Ordinal::Null);
+}
+
+TEST(Resolver, FindConverter)
+{
+    const auto i = Meta::Factory<int>::Resolve();
+    const auto f = Meta::Factory<float>::Resolve();
+
+    Meta::Resolver::Clear();
+    Meta::Factory<int>::Register("int"_hash);
+    Meta::Factory<float>::Register("float"_hash);
+    Meta::Factory<int>::RegisterConverter<float>();
+    ASSERT_EQ(Meta::Resolver::FindConverter(i.ordinal(), f.ordinal()).convertType(), f);
+    ASSERT_FALSE(Meta::Resolver::FindConverter(f.ordinal(), i.ordinal()));
+    ASSERT_FALSE(Meta::Resolver::FindConverter(i.ordinal(), Meta::Type::Ordinal::Null));
+    // A type registered after the matrix was built is not indexed until the next converter registration
+    const auto d = Meta::Factory<double>::Resolve();
+    Meta::Factory<int>::RegisterConverter<double>();
+    ASSERT_EQ(Meta::Resolver::FindConverter(i.ordinal(), f.ordinal()).convertType(), f);
+    const auto generation = Meta::Type::ConvertersGeneration();
+    Meta::Factory<double>::Register("double"_hash);
+    ASSERT_EQ(Meta::Type::ConvertersGeneration(), generation);
+    ASSERT_EQ(i.findConverter(d).convertType(), d);
+    ASSERT_FALSE(d.findConverter(i));
+    // Enough types to switch to the sparse form
+    RegisterResolverTypes(std::make_index_sequence<300>());
+    ASSERT_EQ(i.findConverter(f).convertType(), f);
+    ASSERT_FALSE(f.findConverter(i));
+    Meta::Factory<float>::RegisterConverter<int>();
+    ASSERT_EQ(f.findConverter(i).convertType(), i);
+    Meta::Resolver::Clear();
+    ASSERT_FALSE(i.findConverter(f));
+}
+
+TEST(Resolver, ConcurrentFindConverter)
+{
+    constexpr auto ReaderCount = 4;
+
+    const auto i = Meta::Factory<int>::Resolve();
+    const auto f = Meta::Factory<float>::Resolve();
+    std::atomic<bool> running { true };
+    std::atomic<std::size_t> errors { 0 };
+    std::vector<std::thread> readers;
+
+    Meta::Resolver::Clear();
+    Meta::Factory<int>::Register("int"_hash);
+    Meta::Factory<float>::Register("float"_hash);
+    Meta::Factory<int>::RegisterConverter<float>();
+    for (auto reader = 0; reader < ReaderCount; ++reader) {
+        readers.emplace_back([&running, &errors, i, f] {
+            // Registrations below rebuild the matrix while readers keep using the published one
+            while (running.load()) {
+                if (Meta::Resolver::FindConverter(i.ordinal(), f.ordinal()).convertType() != f)
+                    ++errors;
+            }
+        });
+    }
+    RegisterResolverTypes(std::make_index_sequence<300>());
+    Meta::Factory<float>::RegisterConverter<int>();
+    ASSERT_EQ(Meta::Resolver::FindConverter(f.ordinal(), i.ordinal()).convertType(), i);
+    running = false;
+    for (auto &reader : readers)
+        reader.join();
+    ASSERT_EQ(errors.load(), 0u);
+    Meta::Resolver::ReleaseRetired();
+    ASSERT_EQ(Meta::Resolver::FindConverter(i.ordinal(), f.ordinal()).convertType(), f);
+    Meta::Resolver::Clear();
+}
+
+struct OnDemandA
+{
+    [[nodiscard]] int value(void) const noexcept { return 42; }
+};
+
+struct OnDemandB {};
+
+TEST(Resolver, RegisterOnDemand)
+{
+    Meta::Resolver::Clear();
+    Meta::Registerer::RegisterOnDemand<OnDemandA>("OnDemandA"_hash, [] {
+        Meta::Factory<OnDemandA>::Register("OnDemandA"_hash);
+        Meta::Factory<OnDemandA>::RegisterFunction<&OnDemandA::value>("value"_hash);
+    });
+    Meta::Registerer::RegisterOnDemand<OnDemandB>("OnDemandB"_hash, [] {
+        Meta::Factory<OnDemandB>::Register("OnDemandB"_hash);
+    });
+    Meta::Registerer::EnableOnDemandRegistration();
+    ASSERT_EQ(Meta::Registerer::PendingCount(), 2u);
+    ASSERT_TRUE(Meta::Factory<OnDemandA>::Resolve().findFunction("value"_hash));
+    ASSERT_EQ(Meta::Registerer::PendingCount(), 1u);
+    ASSERT_EQ(Meta::Resolver::FindType("OnDemandB"_hash), Meta::Factory<OnDemandB>::Resolve());
+    ASSERT_EQ(Meta::Registerer::PendingCount(), 0u);
+    ASSERT_FALSE(Meta::Resolver::FindType("OnDemandC"_hash));
+    Meta::Resolver::SetMissHandlers(nullptr, nullptr);
+    Meta::Resolver::Clear();
+}
+
+struct OnDemandThrow {};
+
+TEST(Resolver, RegisterOnDemandThrow)
+{
+    static bool Throw = true;
+
+    Meta::Resolver::Clear();
+    Meta::Registerer::RegisterOnDemand<OnDemandThrow>("OnDemandThrow"_hash, [] {
+        if (Throw)
+            throw std::runtime_error("OnDemandThrow");
+        Meta::Factory<OnDemandThrow>::Register("OnDemandThrow"_hash);
+    });
+    Meta::Registerer::EnableOnDemandRegistration();
+    ASSERT_FALSE(Meta::Resolver::FindType("OnDemandThrow"_hash));
+    ASSERT_EQ(Meta::Registerer::PendingCount(), 1u);
+    Throw = false;
+    ASSERT_EQ(Meta::Resolver::FindType("OnDemandThrow"_hash), Meta::Factory<OnDemandThrow>::Resolve());
+    ASSERT_EQ(Meta::Registerer::PendingCount(), 0u);
+    Meta::Resolver::SetMissHandlers(nullptr, nullptr);
+    Meta::Resolver::Clear();
+}
+
+template<std::size_t Index>
+struct ParallelType
+{
+    [[nodiscard]] std::size_t index(void) const noexcept { return Index; }
+};
 
-TEST(Application, Basics)
+template<std::size_t Index>
+static void RegisterParallelType(void)
 {
+    Meta::Factory<ParallelType<Index>>::Register(static_cast<HashedName>(Index + 1));
+    Meta::Factory<ParallelType<Index>>::template RegisterFunction<&ParallelType<Index>::index>("index"_hash);
+}
+
+template<std::size_t ...Indexes>
+[[nodiscard]] static std::vector<void(*)(void)> MakeParallelTypeTable(std::index_sequence<Indexes...>)
+{
+    return std::vector<void(*)(void)> { &RegisterParallelType<Indexes>... };
+}
+
+template<std::size_t ...Indexes>
+[[nodiscard]] static bool CheckParallelTypes(std::index_sequence<Indexes...>)
+{
+    return ((Meta::Resolver::FindType(static_cast<HashedName>(Indexes + 1)) == Meta::Factory<ParallelType<Indexes>>::Resolve()) && ...)
+        && (Meta::Factory<ParallelType<Indexes>>::Resolve().findFunction("index"_hash) && ...);
+}
+
+TEST(Resolver, RegisterParallel)
+{
+    constexpr auto Sequence = std::make_index_sequence<500>();
+
+    const auto table = MakeParallelTypeTable(Sequence);
+
+    Meta::Resolver::Clear();
+    Meta::Registerer::RegisterParallel(table.begin(), table.end(), 4u);
+    ASSERT_FALSE(Meta::Type::IsValidationDeferred());
+    ASSERT_EQ(Meta::Resolver::OrdinalCount(), 500u);
+    ASSERT_TRUE(CheckParallelTypes(Sequence));
+    Meta::Resolver::Clear();
 }
@@ -3,13 +3,18 @@
  * @ Description: Unit tests of Type
  */
 
+#include <atomic>
 #include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include <Kube/Meta/Meta.hpp>
 
 using namespace kF;
+using namespace kF::Literal;
 
 TEST(Type, TypeFlags)
 {
@@ -64,6 +69,22 @@ TEST(Type, TypeFlags)
     ASSERT_FALSE(ty.isPointer()); // An std::array is not a pointer
 }
 
+TEST(Type, TrivialFlags)
+{
+    Meta::Type ty = Meta::Factory<std::int64_t>::Resolve();
+    ASSERT_TRUE(ty.isTriviallyCopyable());
+    ASSERT_TRUE(ty.isTriviallyDestructible());
+    ASSERT_TRUE(ty.isTriviallyRelocatable());
+    ty = Meta::Factory<std::string>::Resolve();
+    ASSERT_FALSE(ty.isTriviallyCopyable());
+    ASSERT_FALSE(ty.isTriviallyDestructible());
+    ASSERT_FALSE(ty.isTriviallyRelocatable());
+    ty = Meta::Factory<void>::Resolve();
+    ASSERT_FALSE(ty.isTriviallyCopyable());
+    ASSERT_FALSE(ty.isTriviallyDestructible());
+    ASSERT_FALSE(ty.isTriviallyRelocatable());
+}
+
 TEST(Type, BasicsSemantics)
 {
     Meta::Type t1;
@@ -166,4 +187,190 @@ TEST(Type, MetaSemantics)
 // TEST(Type, Operator)
 // {
 
-// }
\ No newline at end of file
+// }
+
+struct CompactOperand
+{
+    int value {};
+
+    [[nodiscard]] CompactOperand operator-(void) const noexcept { return CompactOperand { -value }; }
+};
+
+TEST(Type, SetOperators)
+{
+    Meta::Resolver::Clear();
+    auto type = Meta::Factory<CompactOperand>::Resolve();
+
+    // Registration installs the static operator table of the type in compact mode
+    Meta::Factory<CompactOperand>::Register("CompactOperand"_hash);
+    ASSERT_TRUE(type.hasOperator<Meta::UnaryOperator::Minus>());
+    ASSERT_FALSE(type.hasOperator<Meta::BinaryOperator::Addition>());
+    const CompactOperand operand { 21 };
+    ASSERT_EQ(type.invokeOperator<Meta::UnaryOperator::Minus>(&operand).as<CompactOperand>().value, -21);
+    Meta::Resolver::Clear();
+}
+
+struct BaseA { int a {}; };
+struct BaseB : BaseA { int b {}; };
+struct BaseC : BaseB { int c {}; };
+struct BaseD { int d {}; };
+
+TEST(Type, FindBase)
+{
+    auto a = Meta::Factory<BaseA>::Resolve();
+    auto b = Meta::Factory<BaseB>::Resolve();
+    auto c = Meta::Factory<BaseC>::Resolve();
+    auto d = Meta::Factory<BaseD>::Resolve();
+
+    // Bases are registered from the most derived one to ensure late registrations are propagated
+    Meta::Factory<BaseC>::RegisterBase<BaseB>();
+    ASSERT_EQ(c.findBase(b), b);
+    ASSERT_FALSE(c.findBase(a));
+    Meta::Factory<BaseB>::RegisterBase<BaseA>();
+    ASSERT_EQ(c.findBase(a), a);
+    ASSERT_EQ(c.findBase(b), b);
+    ASSERT_EQ(b.findBase(a), a);
+    ASSERT_FALSE(a.findBase(b));
+    ASSERT_FALSE(c.findBase(d));
+    ASSERT_FALSE(b.findBase(c));
+    b.clear();
+    ASSERT_FALSE(c.findBase(a));
+    ASSERT_EQ(c.findBase(b), b);
+    c.clear();
+    ASSERT_FALSE(c.findBase(b));
+}
+
+struct ConcurrentBaseA {};
+struct ConcurrentBaseB : ConcurrentBaseA {};
+struct ConcurrentBaseC : ConcurrentBaseB {};
+
+TEST(Type, ConcurrentFindBase)
+{
+    constexpr auto ReaderCount = 4;
+
+    auto a = Meta::Factory<ConcurrentBaseA>::Resolve();
+    auto b = Meta::Factory<ConcurrentBaseB>::Resolve();
+    auto c = Meta::Factory<ConcurrentBaseC>::Resolve();
+    std::atomic<bool> running { true };
+    std::atomic<std::size_t> errors { 0 };
+    std::vector<std::thread> readers;
+
+    Meta::Factory<ConcurrentBaseB>::RegisterBase<ConcurrentBaseA>();
+    Meta::Factory<ConcurrentBaseC>::RegisterBase<ConcurrentBaseB>();
+    for (auto reader = 0; reader < ReaderCount; ++reader) {
+        readers.emplace_back([&running, &errors, a, b, c] {
+            // Readers race to flatten the ancestors each time they are invalidated
+            while (running.load()) {
+                if (c.findBase(a) != a || c.findBase(b) != b)
+                    ++errors;
+            }
+        });
+    }
+    for (auto i = 0; i < 1000; ++i)
+        Meta::Type::InvalidateAncestors();
+    running = false;
+    for (auto &reader : readers)
+        reader.join();
+    ASSERT_EQ(errors.load(), 0u);
+    b.clear();
+    c.clear();
+}
+
+struct OffsetA { int a { 1 }; };
+struct OffsetB
+{
+    double b { 2.0 };
+
+    [[nodiscard]] double getB(void) const noexcept { return b; }
+    void setB(const double &value) noexcept { b = value; }
+};
+struct OffsetC : OffsetA, OffsetB { int c { 3 }; };
+struct OffsetD : OffsetC { int d { 4 }; };
+
+TEST(Type, Upcast)
+{
+    Meta::Factory<OffsetC>::RegisterBase<OffsetA>();
+    Meta::Factory<OffsetC>::RegisterBase<OffsetB>();
+    Meta::Factory<OffsetD>::RegisterBase<OffsetC>();
+
+    OffsetD instance;
+    Var var;
+
+    var.assign(instance);
+    ASSERT_EQ(var.tryCast<OffsetD>(), &instance);
+    ASSERT_EQ(var.tryCast<OffsetC>(), static_cast<OffsetC *>(&instance));
+    ASSERT_EQ(var.tryCast<OffsetA>(), static_cast<OffsetA *>(&instance));
+    ASSERT_EQ(var.tryCast<OffsetB>(), static_cast<OffsetB *>(&instance));
+    ASSERT_EQ(var.cast<OffsetB>().b, 2.0);
+    ASSERT_EQ(var.tryCast<int>(), nullptr);
+    ASSERT_EQ(Meta::Factory<OffsetC>::Resolve().upcast(Meta::Factory<OffsetD>::Resolve(), static_cast<void *>(&instance)), nullptr);
+
+    // Datas registered on a base are accessed through the adjusted instance
+    const auto data = Meta::Factory<OffsetB>::RegisterData<&OffsetB::getB, &OffsetB::setB>("b"_hash);
+    ASSERT_EQ(data.ownerType(), Meta::Factory<OffsetB>::Resolve());
+    ASSERT_EQ(data.get(var).as<double>(), 2.0);
+    static_cast<void>(data.set(var, 5.0));
+    ASSERT_EQ(instance.b, 5.0);
+    Meta::Factory<OffsetB>::Resolve().clear();
+    Meta::Factory<OffsetC>::Resolve().clear();
+    Meta::Factory<OffsetD>::Resolve().clear();
+}
+
+struct MembersA { static int Foo(void) { return 1; } static int Bar(void) { return 2; } };
+struct MembersB : MembersA { static int Bar(void) { return 3; } };
+
+TEST(Type, FindFunctionInherited)
+{
+    auto a = Meta::Factory<MembersA>::Resolve();
+    auto b = Meta::Factory<MembersB>::Resolve();
+
+    Meta::Factory<MembersB>::RegisterFunction<&MembersB::Bar>("bar"_hash);
+    ASSERT_FALSE(b.findFunction("foo"_hash));
+    Meta::Factory<MembersB>::RegisterBase<MembersA>();
+    Meta::Factory<MembersA>::RegisterFunction<&MembersA::Foo>("foo"_hash);
+    ASSERT_EQ(b.findFunction("foo"_hash), a.findFunction("foo"_hash));
+    ASSERT_EQ(b.findFunction("bar"_hash).invoke().as<int>(), 3);
+    ASSERT_FALSE(b.findFunction("baz"_hash));
+    a.clear();
+    ASSERT_FALSE(b.findFunction("foo"_hash));
+    ASSERT_TRUE(b.findFunction("bar"_hash));
+    b.clear();
+    ASSERT_FALSE(b.findFunction("bar"_hash));
+}
+
+struct CachedA { static int Foo(void) { return 1; } };
+struct CachedB { static int Foo(void) { return 2; } };
+
+TEST(Type, FunctionCache)
+{
+    auto a = Meta::Factory<CachedA>::Resolve();
+    auto b = Meta::Factory<CachedB>::Resolve();
+    Meta::FunctionCache cache("foo"_hash);
+
+    ASSERT_FALSE(cache.find(a));
+    Meta::Factory<CachedA>::RegisterFunction<&CachedA::Foo>("foo"_hash);
+    ASSERT_EQ(cache.find(a).invoke().as<int>(), 1);
+    ASSERT_FALSE(cache.find(b));
+    Meta::Factory<CachedB>::RegisterFunction<&CachedB::Foo>("foo"_hash);
+    ASSERT_EQ(cache.find(b).invoke().as<int>(), 2);
+    ASSERT_EQ(cache.find(a), a.findFunction("foo"_hash));
+    a.clear();
+    ASSERT_FALSE(cache.find(a));
+    ASSERT_EQ(cache.find(b), b.findFunction("foo"_hash));
+    b.clear();
+    ASSERT_FALSE(cache.find(b));
+}
+
+static constinit Meta::Type::Descriptor ConstantDescriptor { Meta::Type::Descriptor::Construct<int>() };
+
+TEST(Type, ConstantInitializedDescriptor)
+{
+    static_assert(Meta::Internal::OperatorTableInstance<int>.binaryFuncs[static_cast<int>(Meta::BinaryOperator::Addition)] != nullptr);
+    static_assert(std::is_trivially_destructible_v<Meta::Type::Descriptor>);
+
+    const Meta::Type type(&ConstantDescriptor);
+    ASSERT_EQ(type.typeID(), typeid(int));
+    ASSERT_EQ(type.typeSize(), sizeof(int));
+    ASSERT_TRUE(type.hasOperator<Meta::BinaryOperator::Addition>());
+    ASSERT_TRUE(type.literal().empty());
+}
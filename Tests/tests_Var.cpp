@@ -4,6 +4,9 @@
  */
 
 #include <memory>
+#include <memory_resource>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -115,6 +118,13 @@ TEST(Var, TrickyDeepCopy)
     ASSERT_EQ(++value.as<int>(), 43);
     ASSERT_TRUE(tmpRef);
     ASSERT_EQ(x.as<int>(), 42);
+    // A reference of the same type is replaced by a copy rather than written through
+    const auto &constX = x.as<int>();
+    auto constRef = Var::Assign(constX);
+    constRef = value;
+    ASSERT_EQ(constRef.storageType(), Var::StorageType::ValueOptimized);
+    ASSERT_EQ(constRef.as<int>(), 43);
+    ASSERT_EQ(x.as<int>(), 42);
 }
 
 TEST(Var, DestructorCheck)
@@ -264,4 +274,175 @@ TEST(Var, ArrayHandling)
     ASSERT_EQ(*(var - 1).as<int *>(), 12345412);
     var -= 1;
     ASSERT_EQ(*var.as<int *>(), 12345412);
-}
\ No newline at end of file
+}
+
+TEST(Var, BasicVarInlineSize)
+{
+    struct Vec3d { double x, y, z; };
+
+    static_assert(!Var::IsSmallOptimizedType<Vec3d>);
+    static_assert(BasicVar<32>::IsSmallOptimizedType<Vec3d>);
+
+    BasicVar<32> small(Vec3d { 1.0, 2.0, 3.0 });
+    ASSERT_TRUE(small.isSmallOptimizedValue());
+
+    // The value does not fit the default inline storage
+    Var var(small);
+    ASSERT_FALSE(var.isSmallOptimizedValue());
+    ASSERT_EQ(var.as<Vec3d>().z, 3.0);
+
+    // Moving back moves the value into the inline storage
+    BasicVar<64> large(std::move(var));
+    ASSERT_TRUE(large.isSmallOptimizedValue());
+    ASSERT_EQ(large.as<Vec3d>().y, 2.0);
+
+    BasicVar<32> str(std::string("0123456789ABCDEFGHIJ"));
+    ASSERT_EQ(str.isSmallOptimizedValue(), sizeof(std::string) <= 32);
+    var = std::move(str);
+    ASSERT_EQ(var.as<std::string>(), "0123456789ABCDEFGHIJ");
+}
+
+TEST(Var, PoolAllocator)
+{
+    using PoolVar = BasicVar<16, 16, Meta::VarPoolAllocator>;
+    struct alignas(64) Aligned { std::byte data[48] {}; };
+
+    ASSERT_EQ(Meta::VarPoolAllocator::Capacity(20, 8), 32u);
+    ASSERT_EQ(Meta::VarPoolAllocator::Capacity(48, 64), 64u);
+    ASSERT_EQ(Meta::VarPoolAllocator::Capacity(2000, 8), 2000u);
+
+    const auto worker = [] {
+        std::vector<PoolVar> vars;
+        for (auto i = 0u; i != 1000u; ++i) {
+            if (i % 2u)
+                vars.emplace_back(PoolVar::Emplace<std::string>("0123456789ABCDEFGHIJ"));
+            else
+                vars.emplace_back(PoolVar::Emplace<Aligned>());
+        }
+        for (auto i = 0u; i != 1000u; ++i) {
+            if (i % 2u)
+                ASSERT_EQ(vars[i].as<std::string>(), "0123456789ABCDEFGHIJ");
+            else
+                ASSERT_EQ(reinterpret_cast<std::uintptr_t>(vars[i].data()) % alignof(Aligned), 0u);
+        }
+    };
+    std::thread threads[4] { std::thread(worker), std::thread(worker), std::thread(worker), std::thread(worker) };
+    for (auto &thread : threads)
+        thread.join();
+
+    // Moving between allocators keeps the value
+    PoolVar pooled(std::string("0123456789ABCDEFGHIJ"));
+    BasicVar<16, 16, Meta::VarHeapAllocator> heap(std::move(pooled));
+    ASSERT_EQ(heap.as<std::string>(), "0123456789ABCDEFGHIJ");
+}
+
+TEST(Var, PoolAllocatorThreadExit)
+{
+    using PoolVar = BasicVar<16, 16, Meta::VarPoolAllocator>;
+    struct Holder { PoolVar var {}; };
+
+    std::thread([] {
+        // Constructed before the thread cache is registered, so destroyed after it was flushed
+        static thread_local Holder holder {};
+        holder.var = PoolVar(std::string("0123456789ABCDEFGHIJ"));
+        ASSERT_EQ(holder.var.as<std::string>(), "0123456789ABCDEFGHIJ");
+    }).join();
+
+    PoolVar var(std::string("0123456789ABCDEFGHIJ"));
+    ASSERT_EQ(var.as<std::string>(), "0123456789ABCDEFGHIJ");
+}
+
+TEST(Var, MonotonicAllocator)
+{
+    using ArenaVar = BasicVar<16, 16, Meta::VarMonotonicAllocator>;
+    struct Vec3d { double x, y, z; };
+
+    std::byte buffer[1024];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+    {
+        Meta::VarMonotonicAllocator::Scope scope(arena);
+        ArenaVar vec(Vec3d { 1.0, 2.0, 3.0 });
+        ArenaVar str(std::string("0123456789ABCDEFGHIJ"));
+
+        ASSERT_GE(vec.data(), static_cast<void *>(buffer));
+        ASSERT_LT(vec.data(), static_cast<void *>(buffer + sizeof(buffer)));
+        ASSERT_EQ(vec.as<Vec3d>().z, 3.0);
+        ASSERT_EQ(str.as<std::string>(), "0123456789ABCDEFGHIJ");
+    }
+    ASSERT_EQ(Meta::VarMonotonicAllocator::CurrentResource(), nullptr);
+}
+
+TEST(Var, CapacityReuse)
+{
+    using HeapVar = BasicVar<16, 16, Meta::VarHeapAllocator>;
+    struct Vec3d { double x, y, z; };
+    struct Vec4d { double x, y, z, w; };
+
+    HeapVar var(Vec4d { 1.0, 2.0, 3.0, 4.0 });
+    const auto block = var.data();
+    ASSERT_EQ(var.capacity(), sizeof(Vec4d));
+
+    // Smaller values reuse the block, small ones included
+    var.emplace<Vec3d>(Vec3d { 5.0, 6.0, 7.0 });
+    ASSERT_EQ(var.data(), block);
+    ASSERT_EQ(var.as<Vec3d>().z, 7.0);
+    var = HeapVar(42);
+    ASSERT_EQ(var.data(), block);
+    ASSERT_EQ(var.as<int>(), 42);
+
+    // Shrinking moves small values back inline
+    var.shrinkToFit();
+    ASSERT_EQ(var.capacity(), 0u);
+    ASSERT_TRUE(var.isSmallOptimizedValue());
+    ASSERT_EQ(var.as<int>(), 42);
+
+    var.reserveCapacity(64);
+    ASSERT_EQ(var.capacity(), 64u);
+    ASSERT_FALSE(var.isSmallOptimizedValue());
+    ASSERT_EQ(var.as<int>(), 42);
+    const auto reserved = var.data();
+    var.emplace<std::string>("0123456789ABCDEFGHIJ");
+    ASSERT_EQ(var.data(), reserved);
+    ASSERT_EQ(var.as<std::string>(), "0123456789ABCDEFGHIJ");
+    var.shrinkToFit();
+    ASSERT_EQ(var.capacity(), sizeof(std::string));
+    ASSERT_EQ(var.as<std::string>(), "0123456789ABCDEFGHIJ");
+}
+
+namespace
+{
+    /** @brief Owning handle which may be moved with a memcpy */
+    struct RelocatableHandle
+    {
+        static inline int Destructions = 0;
+
+        RelocatableHandle(const int value) : ptr(new int(value)) {}
+        RelocatableHandle(RelocatableHandle &&other) noexcept : ptr(std::exchange(other.ptr, nullptr)) {}
+        ~RelocatableHandle(void) { Destructions += ptr != nullptr; delete ptr; }
+
+        int *ptr;
+    };
+}
+
+template<>
+struct kF::Meta::TriviallyRelocatable<RelocatableHandle> : std::true_type {};
+
+TEST(Var, TrivialSemantics)
+{
+    Var integer(std::int64_t(42));
+    Var copy(integer);
+    Var moved(std::move(integer));
+
+    ASSERT_EQ(copy.as<std::int64_t>(), 42);
+    ASSERT_EQ(moved.as<std::int64_t>(), 42);
+    ASSERT_EQ(integer.as<std::int64_t>(), 42); // Trivially copyable values are left as is
+
+    {
+        Var handle = Var::Emplace<RelocatableHandle>(24);
+        Var relocated(std::move(handle));
+
+        ASSERT_FALSE(handle); // Relocated values are discarded
+        ASSERT_EQ(*relocated.as<RelocatableHandle>().ptr, 24);
+    }
+    ASSERT_EQ(RelocatableHandle::Destructions, 1);
+}
@@ -5,10 +5,17 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <typeinfo>
+
 #include <Kube/Core/FlatVector.hpp>
 #include <Kube/Core/FlatString.hpp>
 
 #include "Base.hpp"
+#include "HashIndex.hpp"
+#include "Published.hpp"
 
 /**
  * @brief Type is used to store meta-data about a type
@@ -28,59 +35,89 @@ public:
     using AssignmentOperatorFunc = void(*)(void *, const Var &);
     using ToBoolFunc = bool(*)(const void *);
 
+    /** @brief Dense index assigned to each type at registration time */
+    enum class Ordinal : std::uint32_t
+    {
+        Null = ~static_cast<std::uint32_t>(0)
+    };
+
     enum Flags : std::uint32_t
     {
-        NoFlags             = 0b0,
-        IsSmallOptimized    = 0b1,
-        IsVoid              = 0b10,
-        IsIntegral          = 0b100,
-        IsFloating          = 0b1000,
-        IsDouble            = 0b10000,
-        IsPointer           = 0b100000
+        NoFlags                 = 0b0,
+        IsSmallOptimized        = 0b1,
+        IsVoid                  = 0b10,
+        IsIntegral              = 0b100,
+        IsFloating              = 0b1000,
+        IsDouble                = 0b10000,
+        IsPointer               = 0b100000,
+        IsTriviallyDestructible = 0b1000000,
+        IsTriviallyCopyable     = 0b10000000,
+        IsTriviallyRelocatable  = 0b100000000
+    };
+
+    /** @brief A direct or indirect base with the offset of its subobject inside the derived type */
+    struct Ancestor;
+
+    /** @brief Flattened ancestors of a type */
+    struct AncestorTable;
+
+    /** @brief Flattened (own and inherited) members of a type, indexed by name */
+    struct MemberTables;
+
+    /** @brief Constructor chosen for a list of argument types */
+    struct ConstructorMatch;
+
+    /** @brief Constructor matches resolved for each list of argument types */
+    struct ConstructorMatches;
+
+    /** @brief Cold part of a descriptor (reflection lists), allocated on first use */
+    struct ColdDescriptor;
+
+    /** @brief Operator functions of a type, constant initialized in read-only data */
+    struct OperatorTable
+    {
+        UnaryOperatorFunc unaryFuncs[static_cast<int>(UnaryOperator::Total)] { nullptr };
+        BinaryOperatorFunc binaryFuncs[static_cast<int>(BinaryOperator::Total)] { nullptr };
+        AssignmentOperatorFunc assignmentFuncs[static_cast<int>(AssignmentOperator::Total)] { nullptr };
+
+        /** @brief Build the operator table of a type at compile time */
+        template<typename Type>
+        [[nodiscard]] static constexpr OperatorTable Make(void) noexcept;
     };
 
+    /** @brief Descriptor of a type, constant initialized so that resolving a type never runs a dynamic initializer */
     struct alignas_double_cacheline Descriptor
     {
         // --- Cacheline 1 ---
-        /* Type description - 32 bytes */
-        const TypeID typeID; // Unique type identifier
+        /* Type description - 24 bytes */
+        const std::type_info * const typeInfo; // Unique type identifier
         const std::uint32_t typeSize; // Size of the type
         const std::uint32_t typeAlignment; // Size of the type
-        HashedName name; // Hashed name of the type
         const Flags flags; // Flags that describe the type
-        Core::FlatString literal; // Type literal
+        Ordinal ordinal { Ordinal::Null }; // Dense index of the type, assigned by the resolver
 
-        /* Type semantics - 56 bytes */
+        /* Type semantics used by Var - 40 bytes */
         const DestructorFunc destructFunc;
-        const DefaultConstructorFunc defaultConstructFunc;
         const CopyConstructorFunc copyConstructFunc;
         const MoveConstructorFunc moveConstructFunc;
+        const ToBoolFunc toBoolFunc;
+        const DefaultConstructorFunc defaultConstructFunc;
+
         // --- Cacheline 2 ---
+        /* Type assignment semantics - 16 bytes */
         const CopyAssignmentFunc copyAssignmentFunc;
         const MoveAssignmentFunc moveAssignmentFunc;
-        const ToBoolFunc toBoolFunc;
-
-        /* Fast unary and binary operators - 88 bytes */
-        const UnaryOperatorFunc unaryFuncs[static_cast<int>(UnaryOperator::Total)] { nullptr };
-        const BinaryOperatorFunc binaryFuncs[static_cast<int>(BinaryOperator::Total)] { nullptr };
-        const AssignmentOperatorFunc assignmentFuncs[static_cast<int>(AssignmentOperator::Total)] { nullptr };
-        char _padding[32]; // Padding to the next cacheline
-
-        // --- Cacheline 4 ---
 
-        /* Type registerable meta-data - 48 bytes */
-        Core::FlatVector<Constructor> constructors;
-        Core::FlatVector<Type> bases {};
-        Core::FlatVector<Converter> converters {};
-        Core::FlatVector<Function> functions {};
-        Core::FlatVector<Data> datas {};
-        Core::FlatVector<Signal> signals {};
+        /* Registration data - 24 bytes */
+        HashedName name { 0 }; // Hashed name of the type
+        const OperatorTable *operators; // Static operator table (replaced at registration in compact mode)
+        std::atomic<ColdDescriptor *> cold { nullptr }; // Published on first use, released at exit
 
         template<typename Type>
-        [[nodiscard]] static Descriptor Construct(void) noexcept;
+        [[nodiscard]] static constexpr Descriptor Construct(void) noexcept;
     };
 
-    static_assert_sizeof(Descriptor, Core::CacheLineSize * 4);
+    static_assert_sizeof(Descriptor, Core::CacheLineSize * 2);
     static_assert_alignof_double_cacheline(Descriptor);
 
     /** @brief Default constructor */
@@ -103,13 +140,16 @@ public:
     [[nodiscard]] bool operator!=(const Type &other) const noexcept { return _desc != other._desc; }
 
     /** @brief Retreive type's ID */
-    [[nodiscard]] TypeID typeID(void) const noexcept { return _desc->typeID; }
+    [[nodiscard]] TypeID typeID(void) const noexcept { return TypeID(*_desc->typeInfo); }
 
     /** @brief Retreive type's name */
     [[nodiscard]] HashedName name(void) const noexcept { return _desc->name; }
 
+    /** @brief Retreive type's ordinal (Ordinal::Null if the type is not registered) */
+    [[nodiscard]] Ordinal ordinal(void) const noexcept { return _desc->ordinal; }
+
     /** @brief Retreive type's name */
-    [[nodiscard]] std::string_view literal(void) const noexcept { return _desc->literal.toStdView(); }
+    [[nodiscard]] std::string_view literal(void) const noexcept;
 
     /** @brief Retreive type' size */
     [[nodiscard]] std::size_t typeSize(void) const noexcept { return _desc->typeSize; }
@@ -117,9 +157,13 @@ public:
     /** @brief Retreive type' alignment */
     [[nodiscard]] std::size_t typeAlignment(void) const noexcept { return _desc->typeAlignment; }
 
-    /** @brief Check if type is optimized */
+    /** @brief Check if type is stored in the inline storage of the default Var */
     [[nodiscard]] bool isSmallOptimized(void) const noexcept { return _desc->flags & Flags::IsSmallOptimized; }
 
+    /** @brief Check if type is stored in the inline storage of a BasicVar of given size and alignment */
+    template<std::size_t InlineSize, std::size_t Alignment>
+    [[nodiscard]] bool isSmallOptimized(void) const noexcept;
+
     /** @brief Check if type is void */
     [[nodiscard]] bool isVoid(void) const noexcept { return _desc->flags & Flags::IsVoid; }
 
@@ -135,6 +179,15 @@ public:
     /** @brief Check if type is pointer */
     [[nodiscard]] bool isPointer(void) const noexcept { return _desc->flags & Flags::IsPointer; }
 
+    /** @brief Check if type destructor does nothing */
+    [[nodiscard]] bool isTriviallyDestructible(void) const noexcept { return _desc->flags & Flags::IsTriviallyDestructible; }
+
+    /** @brief Check if type can be copied with a memcpy */
+    [[nodiscard]] bool isTriviallyCopyable(void) const noexcept { return _desc->flags & Flags::IsTriviallyCopyable; }
+
+    /** @brief Check if type can be moved with a memcpy, discarding the source without destruction */
+    [[nodiscard]] bool isTriviallyRelocatable(void) const noexcept { return _desc->flags & Flags::IsTriviallyRelocatable; }
+
     /** @brief Check if type is default constructible */
     [[nodiscard]] bool isDefaultConstructible(void) const noexcept { return _desc->defaultConstructFunc; }
 
@@ -178,18 +231,67 @@ public:
     void destruct(void *data) const { (*_desc->destructFunc)(data); }
 
     /** @brief Check the existence of  a meta given Unary / Binary / Assigment operator */
-    template<UnaryOperator Operator> [[nodiscard]] bool hasOperator(void) const noexcept { return _desc->unaryFuncs[static_cast<int>(Operator)]; }
-    template<BinaryOperator Operator> [[nodiscard]] bool hasOperator(void) const noexcept { return _desc->binaryFuncs[static_cast<int>(Operator)]; }
-    template<AssignmentOperator Operator> [[nodiscard]] bool hasOperator(void) const noexcept { return _desc->assignmentFuncs[static_cast<int>(Operator)]; }
+    template<UnaryOperator Operator> [[nodiscard]] bool hasOperator(void) const noexcept;
+    template<BinaryOperator Operator> [[nodiscard]] bool hasOperator(void) const noexcept;
+    template<AssignmentOperator Operator> [[nodiscard]] bool hasOperator(void) const noexcept;
 
     /** @brief Invoke a meta given Unary / Binary / Assigment operator */
     template<UnaryOperator Operator> [[nodiscard]] Var invokeOperator(const void *data) const;
     template<BinaryOperator Operator> [[nodiscard]] Var invokeOperator(const void *data, const Var &rhs) const;
     template<AssignmentOperator Operator> void invokeOperator(void *data, const Var &rhs) const;
 
-    /** @brief Find a registered meta base */
+    /** @brief Find a registered meta base (direct or indirect) */
     [[nodiscard]] Type findBase(const Type type) const noexcept;
 
+    /** @brief Adjust an instance pointer to one of its bases (or itself), returns nullptr if 'base' is not an ancestor */
+    [[nodiscard]] void *upcast(const Type base, void *instance) const noexcept;
+    [[nodiscard]] const void *upcast(const Type base, const void *instance) const noexcept
+        { return upcast(base, const_cast<void *>(instance)); }
+
+    /** @brief Invalidate the flattened ancestors of every type, must be called each time a base is registered */
+    static void InvalidateAncestors(void) noexcept { ++_AncestorsGeneration; }
+
+    /** @brief Invalidate the flattened members of every type, must be called each time a base or a member is registered */
+    static void InvalidateMembers(void) noexcept { ++_MembersGeneration; }
+
+    /** @brief Get the current members generation, which changes each time the members of any type change */
+    [[nodiscard]] static std::uint32_t MembersGeneration(void) noexcept { return _MembersGeneration; }
+
+    /** @brief Invalidate the conversion matrix and constructor resolutions, must be called each time a converter is registered */
+    static void InvalidateConverters(void) noexcept { ++_ConvertersGeneration; ++_ConstructorsGeneration; }
+
+    /** @brief Get the current converters generation, which changes each time the converters of any type change */
+    [[nodiscard]] static std::uint32_t ConvertersGeneration(void) noexcept { return _ConvertersGeneration; }
+
+    /** @brief Invalidate constructor resolutions of every type, must be called each time a constructor is registered */
+    static void InvalidateConstructors(void) noexcept { ++_ConstructorsGeneration; }
+
+    /**
+     * @brief Defer the duplicate checks of registrations until 'validateMembers' runs
+     *
+     * Used by parallel registration: the checks look up other types and must not run while they are registered
+     */
+    static void DeferValidation(const bool defer) noexcept { _ValidationDeferred.store(defer, std::memory_order_release); }
+
+    /** @brief Check if the duplicate checks of registrations are deferred */
+    [[nodiscard]] static bool IsValidationDeferred(void) noexcept { return _ValidationDeferred.load(std::memory_order_acquire); }
+
+    /** @brief Check in a single pass that the bases, constructors, converters and members registered on the type are unique */
+    void validateMembers(void) const noexcept_ndebug;
+
+    /**
+     * @brief Flatten ancestors and members of the type
+     *
+     * Lookups flatten lazily, calling this function ahead ensures that further lookups won't modify the descriptor
+     */
+    void flatten(void) const noexcept;
+
+    /** @brief Release the flattened tables replaced by newer ones, must not run concurrently with lookups on the type */
+    void releaseRetired(void) const noexcept;
+
+    /** @brief Get registered meta converters */
+    [[nodiscard]] const Core::FlatVector<Converter> &converters(void) const noexcept;
+
     /** @brief Find a registered meta converter */
     [[nodiscard]] Converter findConverter(const Type type) const noexcept;
 
@@ -221,9 +323,152 @@ public:
      */
     [[nodiscard]] Constructor findConstructor(const std::vector<Type> &types) const noexcept;
 
+    /**
+     * @brief Resolve the best matched constructor of a list of runtime meta types
+     *
+     * Resolutions are cached by argument types until a constructor or a converter is registered (thread safe).
+     * The constructor of the match is null if no constructor accepts the arguments.
+     */
+    [[nodiscard]] ConstructorMatch resolveConstructor(const Type *types, const std::size_t count) const noexcept;
+
+    /** @brief Get the cold part of the descriptor, allocating it on first use (thread safe) */
+    [[nodiscard]] ColdDescriptor &cold(void) const noexcept;
+
     /** @brief Clear the registered type meta-data */
     void clear(void);
 
 private:
+    /** @brief The resolver assigns ordinals and factories install operator tables at registration */
+    friend class Resolver;
+    template<typename RegisteredType>
+    friend class FactoryBase;
+
     Descriptor * _desc = nullptr;
-};
\ No newline at end of file
+
+    /** @brief Set type's ordinal, used by the resolver at registration time */
+    void setOrdinal(const Ordinal ordinal) const noexcept { _desc->ordinal = ordinal; }
+
+    /** @brief Install the operator table of the type, used at registration in compact mode */
+    void setOperators(const OperatorTable &operators) const noexcept { _desc->operators = &operators; }
+
+    /** @brief Get the cold part of the descriptor if it has been allocated */
+    [[nodiscard]] ColdDescriptor *findCold(void) const noexcept { return _desc->cold.load(std::memory_order_acquire); }
+
+    /** @brief Run the pending on-demand registration of an unregistered type, returns true if one ran */
+    [[nodiscard]] bool registerOnDemand(void) const noexcept;
+
+    /** @brief Allocate and publish the cold part of the descriptor */
+    [[nodiscard]] ColdDescriptor &materializeCold(void) const noexcept;
+
+    /** @brief Owns every allocated cold descriptor so that static descriptors stay trivially destructible */
+    struct ColdDescriptorList;
+
+    /** @brief Every cold descriptor, released at exit */
+    static ColdDescriptorList _ColdDescriptors;
+
+    /** @brief Incremented each time the hierarchy of any type changes */
+    static inline std::atomic<std::uint32_t> _AncestorsGeneration { 1u };
+
+    /** @brief Incremented each time the hierarchy or the members of any type change */
+    static inline std::atomic<std::uint32_t> _MembersGeneration { 1u };
+
+    /** @brief Incremented each time the converters of any type change */
+    static inline std::atomic<std::uint32_t> _ConvertersGeneration { 1u };
+
+    /** @brief Incremented each time the constructors or the converters of any type change */
+    static inline std::atomic<std::uint32_t> _ConstructorsGeneration { 1u };
+
+    /** @brief Set while registrations skip their duplicate checks */
+    static inline std::atomic<bool> _ValidationDeferred { false };
+
+    /** @brief Serializes the publication of cached lookups, readers never take it */
+    static inline std::mutex _PublishMutex {};
+
+    /** @brief Get the flattened ancestors, publishing them if needed (thread safe) */
+    [[nodiscard]] const AncestorTable &ancestorTable(void) const noexcept;
+
+    /** @brief Flatten and publish the ancestors if they are outdated, '_PublishMutex' must be locked */
+    const AncestorTable &flattenAncestors(void) const noexcept;
+
+    /** @brief Find a flattened ancestor */
+    [[nodiscard]] const Ancestor *findAncestor(const Type type) const noexcept;
+
+
+    /** @brief Score every constructor against a list of argument types and return the best one */
+    [[nodiscard]] Constructor scoreConstructors(const Type *types, const std::size_t count) const noexcept;
+
+    /** @brief Get the flattened members, publishing them if needed (thread safe) */
+    [[nodiscard]] const MemberTables &memberTables(void) const noexcept;
+
+    /** @brief Flatten and publish own and inherited members if they are outdated, '_PublishMutex' must be locked */
+    const MemberTables &flattenMembers(void) const noexcept;
+};
+
+struct kF::Meta::Type::Ancestor
+{
+    Type type {};
+    std::ptrdiff_t offset { 0 };
+};
+
+struct kF::Meta::Type::AncestorTable
+{
+    std::uint32_t generation { 0u }; // Value of 'AncestorsGeneration' when the ancestors were flattened
+    Core::FlatVector<Ancestor> ancestors {}; // Every direct and indirect base, sorted by descriptor address
+};
+
+struct kF::Meta::Type::ColdDescriptor
+{
+    /* Lazily flattened data */
+    Internal::Published<AncestorTable> ancestors {}; // Republished when the hierarchy of any type changes
+    Internal::Published<MemberTables> memberTables {}; // Republished when the hierarchy or the members of any type change
+    Internal::Published<ConstructorMatches> constructorMatches {}; // Republished when the constructors or the converters of any type change
+
+    /* Type registerable meta-data */
+    Core::FlatString literal {}; // Type literal
+    Core::FlatVector<Constructor> constructors {};
+    Core::FlatVector<Type> bases {};
+    Core::FlatVector<std::ptrdiff_t> baseOffsets {}; // Offset of each base subobject, in the same order as 'bases'
+    Core::FlatVector<Converter> converters {};
+    Core::FlatVector<Function> functions {};
+    Core::FlatVector<Data> datas {};
+    Core::FlatVector<Signal> signals {};
+
+    ColdDescriptor *next { nullptr }; // Next cold descriptor in the list released at exit
+};
+
+struct kF::Meta::Type::ColdDescriptorList
+{
+    std::atomic<ColdDescriptor *> head { nullptr };
+
+    /** @brief Release every cold descriptor */
+    ~ColdDescriptorList(void) noexcept;
+};
+
+inline kF::Meta::Type::ColdDescriptorList kF::Meta::Type::_ColdDescriptors {};
+
+struct kF::Meta::Type::MemberTables
+{
+    std::uint32_t generation { 0u }; // Value of 'MembersGeneration' when the tables were flattened
+    Core::FlatVector<Function> functions {}; // Own functions first, then those of each base in registration order
+    Core::FlatVector<Data> datas {};
+    Core::FlatVector<Signal> signals {};
+    Internal::HashIndex functionIndex {}; // HashedName -> position in 'functions'
+    Internal::HashIndex dataIndex {}; // HashedName -> position in 'datas'
+    Internal::HashIndex signalIndex {}; // HashedName -> position in 'signals'
+};
+
+namespace kF
+{
+    namespace Meta
+    {
+        namespace Internal
+        {
+            /** @brief Operator table of a type, constant initialized in read-only data */
+            template<typename UnarrangedType>
+            inline constexpr Type::OperatorTable OperatorTableInstance = Type::OperatorTable::Make<UnarrangedType>();
+
+            /** @brief Operator table of types without operators */
+            inline constexpr Type::OperatorTable EmptyOperatorTable {};
+        }
+    }
+}
@@ -3,41 +3,17 @@
  * @ Description: Meta Type
  */
 
+#include <algorithm>
+#include <array>
+#include <vector>
+
 template<typename UnarrangedType>
-kF::Meta::Type::Descriptor kF::Meta::Type::Descriptor::Construct(void) noexcept
+constexpr kF::Meta::Type::Descriptor kF::Meta::Type::Descriptor::Construct(void) noexcept
 {
-#define MakeOperatorIf(OpType, Op, Condition, Exact) \
-    ConstexprTernary((!std::is_same_v<Type, void>), \
-        ConstexprTernary((std::is_integral_v<Type> || Condition || (std::experimental::is_detected_exact_v<Exact, Internal::OpType##Op##Check, Type>)), \
-            (&Internal::Make##OpType##Operator<Type, &Internal::OpType##Op<Type>, OpType##Operator::Op>), \
-            nullptr \
-        ), \
-        nullptr \
-    )
-
-#define MakeOperatorIfPointerable(OpType, Op, Condition, Exact) \
-    ConstexprTernary((std::is_array_v<Type> || std::is_pointer_v<Type>), \
-        (&Internal::Make##OpType##Operator<Type, &Internal::OpType##Op##Pointer<Type>, Meta::OpType##Operator::Op>), \
-        MakeOperatorIf(OpType, Op, Condition, Exact) \
-    )
-
-#define MakeOperatorIfUnary(Op, Condition) MakeOperatorIf(Binary, Op, Condition, Type)
-#define MakeOperatorIfBinary(Op, Condition) MakeOperatorIf(Binary, Op, Condition, Type)
-#define MakeOperatorIfAssignment(Op, Condition) MakeOperatorIf(Assignment, Op, Condition, Type &)
-#define MakeOperatorUnary(Op) MakeOperatorIf(Unary, Op, false, Type)
-#define MakeOperatorBinary(Op) MakeOperatorIf(Binary, Op, false, Type)
-#define MakeOperatorAssignment(Op) MakeOperatorIf(Assignment, Op, false, Type &)
-#define MakeOperatorPointerableUnary(Op) MakeOperatorIfPointerable(Unary, Op, false, Type)
-#define MakeOperatorPointerableBinary(Op) MakeOperatorIfPointerable(Binary, Op, false, Type)
-#define MakeOperatorPointerableAssignment(Op) MakeOperatorIfPointerable(Assignment, Op, false, Type &)
-#define MakeOperatorIfPointerableUnary(Op, Condition) MakeOperatorIfPointerable(Unary, Op, Condition, Type)
-#define MakeOperatorIfPointerableBinary(Op, Condition) MakeOperatorIfPointerable(Binary, Op, Condition, Type)
-#define MakeOperatorIfPointerableAssignment(Op, Condition) MakeOperatorIfPointerable(Assignment, Op, Condition, Type &)
-
     using Type = typename Internal::ArrangeType<UnarrangedType>::Type;
 
     return Descriptor {
-        typeID: typeid(Type),
+        typeInfo: &typeid(Type),
         typeSize: ConstexprTernary((!std::is_same_v<Type, void>),
             sizeof(Type),
             0u
@@ -46,7 +22,6 @@ kF::Meta::Type::Descriptor kF::Meta::Type::Descriptor::Construct(void) noexcept
             alignof(Type),
             0u
         ),
-        name: 0,
         flags: [] {
             return static_cast<Flags>(
                     (Internal::IsVarSmallOptimized<Type> ? Flags::IsSmallOptimized : Flags::NoFlags)
@@ -55,17 +30,16 @@ kF::Meta::Type::Descriptor kF::Meta::Type::Descriptor::Construct(void) noexcept
                 |   (std::is_floating_point_v<Type> ? Flags::IsFloating : Flags::NoFlags)
                 |   (std::is_same_v<Type, double> ? Flags::IsDouble : Flags::NoFlags)
                 |   (std::is_array_v<Type> || std::is_pointer_v<Type> ? Flags::IsPointer : Flags::NoFlags)
+                |   (std::is_trivially_destructible_v<Type> ? Flags::IsTriviallyDestructible : Flags::NoFlags)
+                |   (std::is_trivially_copyable_v<Type> ? Flags::IsTriviallyCopyable : Flags::NoFlags)
+                |   (TriviallyRelocatable<Type>::value ? Flags::IsTriviallyRelocatable : Flags::NoFlags)
             );
         }(),
-        literal: Core::FlatString {},
+        ordinal: Ordinal::Null,
         destructFunc: ConstexprTernary(std::is_destructible_v<Type>,
             &Internal::MakeDestructor<Type>,
             nullptr
         ),
-        defaultConstructFunc: ConstexprTernary((!std::is_same_v<Type, void> && std::is_default_constructible_v<Type>),
-            &Internal::MakeDefaultConstructor<Type>,
-            nullptr
-        ),
         copyConstructFunc: ConstexprTernary((!std::is_same_v<Type, void> && std::is_copy_constructible_v<Type>),
             &Internal::MakeCopyConstructor<Type>,
             nullptr
@@ -74,6 +48,14 @@ kF::Meta::Type::Descriptor kF::Meta::Type::Descriptor::Construct(void) noexcept
             &Internal::MakeMoveConstructor<Type>,
             nullptr
         ),
+        toBoolFunc: ConstexprTernary((std::is_convertible_v<Type, bool> || std::experimental::is_detected_v<Internal::BoolOperatorCheck, Type>),
+            &Internal::MakeToBool<Type>,
+            nullptr
+        ),
+        defaultConstructFunc: ConstexprTernary((!std::is_same_v<Type, void> && std::is_default_constructible_v<Type>),
+            &Internal::MakeDefaultConstructor<Type>,
+            nullptr
+        ),
         copyAssignmentFunc: ConstexprTernary((!std::is_same_v<Type, void> && std::is_copy_assignable_v<Type>),
             &Internal::MakeCopyAssignment<Type>,
             nullptr
@@ -82,10 +64,49 @@ kF::Meta::Type::Descriptor kF::Meta::Type::Descriptor::Construct(void) noexcept
             &Internal::MakeMoveAssignment<Type>,
             nullptr
         ),
-        toBoolFunc: ConstexprTernary((std::is_convertible_v<Type, bool> || std::experimental::is_detected_v<Internal::BoolOperatorCheck, Type>),
-            &Internal::MakeToBool<Type>,
-            nullptr
-        ),
+        name: 0,
+#if KF_META_COMPACT_DESCRIPTORS
+        operators: &Internal::EmptyOperatorTable
+#else
+        operators: &Internal::OperatorTableInstance<UnarrangedType>
+#endif
+    };
+}
+
+template<typename UnarrangedType>
+constexpr kF::Meta::Type::OperatorTable kF::Meta::Type::OperatorTable::Make(void) noexcept
+{
+#define MakeOperatorIf(OpType, Op, Condition, Exact) \
+    ConstexprTernary((!std::is_same_v<Type, void>), \
+        ConstexprTernary((std::is_integral_v<Type> || Condition || (std::experimental::is_detected_exact_v<Exact, Internal::OpType##Op##Check, Type>)), \
+            (&Internal::Make##OpType##Operator<Type, &Internal::OpType##Op<Type>, OpType##Operator::Op>), \
+            nullptr \
+        ), \
+        nullptr \
+    )
+
+#define MakeOperatorIfPointerable(OpType, Op, Condition, Exact) \
+    ConstexprTernary((std::is_array_v<Type> || std::is_pointer_v<Type>), \
+        (&Internal::Make##OpType##Operator<Type, &Internal::OpType##Op##Pointer<Type>, Meta::OpType##Operator::Op>), \
+        MakeOperatorIf(OpType, Op, Condition, Exact) \
+    )
+
+#define MakeOperatorIfUnary(Op, Condition) MakeOperatorIf(Binary, Op, Condition, Type)
+#define MakeOperatorIfBinary(Op, Condition) MakeOperatorIf(Binary, Op, Condition, Type)
+#define MakeOperatorIfAssignment(Op, Condition) MakeOperatorIf(Assignment, Op, Condition, Type &)
+#define MakeOperatorUnary(Op) MakeOperatorIf(Unary, Op, false, Type)
+#define MakeOperatorBinary(Op) MakeOperatorIf(Binary, Op, false, Type)
+#define MakeOperatorAssignment(Op) MakeOperatorIf(Assignment, Op, false, Type &)
+#define MakeOperatorPointerableUnary(Op) MakeOperatorIfPointerable(Unary, Op, false, Type)
+#define MakeOperatorPointerableBinary(Op) MakeOperatorIfPointerable(Binary, Op, false, Type)
+#define MakeOperatorPointerableAssignment(Op) MakeOperatorIfPointerable(Assignment, Op, false, Type &)
+#define MakeOperatorIfPointerableUnary(Op, Condition) MakeOperatorIfPointerable(Unary, Op, Condition, Type)
+#define MakeOperatorIfPointerableBinary(Op, Condition) MakeOperatorIfPointerable(Binary, Op, Condition, Type)
+#define MakeOperatorIfPointerableAssignment(Op, Condition) MakeOperatorIfPointerable(Assignment, Op, Condition, Type &)
+
+    using Type = typename Internal::ArrangeType<UnarrangedType>::Type;
+
+    return OperatorTable {
         unaryFuncs: {
             MakeOperatorUnary(Minus)
         },
@@ -163,12 +184,39 @@ inline kF::Var kF::Meta::Type::moveConstruct(void *data) const
     return var;
 }
 
+template<std::size_t InlineSize, std::size_t Alignment>
+inline bool kF::Meta::Type::isSmallOptimized(void) const noexcept
+{
+    if constexpr (InlineSize == Internal::VarSmallOptimizationSize && Alignment == Internal::VarSmallOptimizationAlignment)
+        return isSmallOptimized();
+    else
+        return !isVoid() && _desc->typeSize <= InlineSize && _desc->typeAlignment <= Alignment;
+}
+
+template<kF::Meta::UnaryOperator Operator>
+inline bool kF::Meta::Type::hasOperator(void) const noexcept
+{
+    return _desc->operators->unaryFuncs[static_cast<int>(Operator)];
+}
+
+template<kF::Meta::BinaryOperator Operator>
+inline bool kF::Meta::Type::hasOperator(void) const noexcept
+{
+    return _desc->operators->binaryFuncs[static_cast<int>(Operator)];
+}
+
+template<kF::Meta::AssignmentOperator Operator>
+inline bool kF::Meta::Type::hasOperator(void) const noexcept
+{
+    return _desc->operators->assignmentFuncs[static_cast<int>(Operator)];
+}
+
 template<kF::Meta::UnaryOperator Operator>
 inline kF::Var kF::Meta::Type::invokeOperator(const void *data) const
 {
     kFAssert(hasOperator<Operator>(),
         throw std::runtime_error("Meta::Type::invokeOperator: Operator not available"));
-    return (*_desc->unaryFuncs[static_cast<int>(Operator)])(data);
+    return (*_desc->operators->unaryFuncs[static_cast<int>(Operator)])(data);
 }
 
 template<kF::Meta::BinaryOperator Operator>
@@ -176,7 +224,7 @@ inline kF::Var kF::Meta::Type::invokeOperator(const void *data, const Var &rhs)
 {
     kFAssert(hasOperator<Operator>(),
         throw std::runtime_error("Meta::Type::invokeOperator: Operator not available"));
-    return (*_desc->binaryFuncs[static_cast<int>(Operator)])(data, rhs);
+    return (*_desc->operators->binaryFuncs[static_cast<int>(Operator)])(data, rhs);
 }
 
 template<kF::Meta::AssignmentOperator Operator>
@@ -184,87 +232,318 @@ inline void kF::Meta::Type::invokeOperator(void *data, const Var &rhs) const
 {
     kFAssert(hasOperator<Operator>(),
         throw std::runtime_error("Meta::Type::invokeOperator: Operator not available"));
-    return (*_desc->assignmentFuncs[static_cast<int>(Operator)])(data, rhs);
+    return (*_desc->operators->assignmentFuncs[static_cast<int>(Operator)])(data, rhs);
 }
 
-inline kF::Meta::Type kF::Meta::Type::findBase(const Meta::Type type) const noexcept
+inline kF::Meta::Type::ColdDescriptor &kF::Meta::Type::cold(void) const noexcept
+{
+    if (const auto cold = findCold(); cold) [[likely]]
+        return *cold;
+    return materializeCold();
+}
+
+inline kF::Meta::Type::ColdDescriptor &kF::Meta::Type::materializeCold(void) const noexcept
 {
-    if (_desc->bases.empty()) [[likely]] // Most of manipuled data will not have bases
-        return Type();
-    for (const auto &base : _desc->bases) {
-        if (base == type)
-            return base;
+    const auto created = new ColdDescriptor {};
+    ColdDescriptor *expected = nullptr;
+
+    // Another thread may publish its own cold descriptor first
+    if (!_desc->cold.compare_exchange_strong(expected, created, std::memory_order_acq_rel, std::memory_order_acquire)) [[unlikely]] {
+        delete created;
+        return *expected;
     }
-    for (auto base : _desc->bases) {
-        if (base = base.findBase(type); base)
-            return base;
+    // Descriptors are trivially destructible, the cold descriptor is owned by the global list
+    created->next = _ColdDescriptors.head.load(std::memory_order_relaxed);
+    while (!_ColdDescriptors.head.compare_exchange_weak(created->next, created, std::memory_order_release, std::memory_order_relaxed));
+    return *created;
+}
+
+inline kF::Meta::Type::ColdDescriptorList::~ColdDescriptorList(void) noexcept
+{
+    for (auto cold = head.exchange(nullptr, std::memory_order_acquire); cold;) {
+        const auto next = cold->next;
+        delete cold;
+        cold = next;
     }
+}
+
+inline std::string_view kF::Meta::Type::literal(void) const noexcept
+{
+    if (const auto cold = findCold(); cold)
+        return cold->literal.toStdView();
+    return std::string_view();
+}
+
+inline bool kF::Meta::Type::registerOnDemand(void) const noexcept
+{
+    return !_desc->name && Resolver::RegisterOnDemand(typeID());
+}
+
+inline kF::Meta::Type kF::Meta::Type::findBase(const Meta::Type type) const noexcept
+{
+    if (const auto cold = findCold(); !cold || cold->bases.empty()) [[likely]] // Most of manipuled data will not have bases
+        return registerOnDemand() ? findBase(type) : Type();
+    else if (findAncestor(type)) [[likely]]
+        return type;
     return Type();
 }
 
+inline void *kF::Meta::Type::upcast(const Type base, void *instance) const noexcept
+{
+    if (*this == base) [[likely]]
+        return instance;
+    else if (const auto cold = findCold(); !cold || cold->bases.empty()) [[likely]]
+        return registerOnDemand() ? upcast(base, instance) : nullptr;
+    else if (const auto ancestor = findAncestor(base); ancestor) [[likely]]
+        return reinterpret_cast<std::byte *>(instance) + ancestor->offset;
+    return nullptr;
+}
+
+inline const kF::Meta::Type::Ancestor *kF::Meta::Type::findAncestor(const Type type) const noexcept
+{
+    const auto &ancestors = ancestorTable().ancestors;
+    const auto it = std::lower_bound(ancestors.begin(), ancestors.end(), type._desc,
+        [](const Ancestor &lhs, const Descriptor *rhs) { return lhs.type._desc < rhs; });
+
+    if (it != ancestors.end() && it->type == type) [[likely]]
+        return &*it;
+    return nullptr;
+}
+
+inline const kF::Meta::Type::AncestorTable &kF::Meta::Type::ancestorTable(void) const noexcept
+{
+    if (const auto table = cold().ancestors.get(); table && table->generation == _AncestorsGeneration) [[likely]]
+        return *table;
+    std::lock_guard lock(_PublishMutex);
+    return flattenAncestors();
+}
+
+inline const kF::Meta::Type::AncestorTable &kF::Meta::Type::flattenAncestors(void) const noexcept
+{
+    auto &cold = this->cold();
+    const auto generation = _AncestorsGeneration.load(std::memory_order_acquire);
+
+    // Another thread may have published them while the lock was taken
+    if (const auto table = cold.ancestors.get(); table && table->generation == generation)
+        return *table;
+    AncestorTable table { .generation = generation };
+    auto &ancestors = table.ancestors;
+    // When a base is reachable through several paths, the first one is kept
+    const auto insert = [&ancestors](const Type type, const std::ptrdiff_t offset) {
+        if (std::find_if(ancestors.begin(), ancestors.end(), [type](const Ancestor &ancestor) { return ancestor.type == type; }) == ancestors.end())
+            ancestors.push(Ancestor { type, offset });
+    };
+
+    for (auto i = 0u; i != cold.bases.size(); ++i) {
+        const auto base = cold.bases[i];
+        const auto offset = cold.baseOffsets[i];
+        insert(base, offset);
+        for (const auto &ancestor : base.flattenAncestors().ancestors)
+            insert(ancestor.type, offset + ancestor.offset);
+    }
+    std::sort(ancestors.begin(), ancestors.end(), [](const Ancestor &lhs, const Ancestor &rhs) { return lhs.type._desc < rhs.type._desc; });
+    return cold.ancestors.publish(std::move(table));
+}
+
 inline kF::Meta::Converter kF::Meta::Type::findConverter(const Meta::Type type) const noexcept
 {
-    for (const auto &conv : _desc->converters)
-        if (conv.convertType() == type)
-            return conv;
+    // Registered types are resolved through the conversion matrix
+    if (ordinal() != Ordinal::Null && type.ordinal() != Ordinal::Null) [[likely]]
+        return Resolver::FindConverter(ordinal(), type.ordinal());
+    const bool registered = registerOnDemand();
+    if (type.registerOnDemand() || registered) [[unlikely]]
+        return findConverter(type);
+    if (const auto cold = findCold(); cold) {
+        for (const auto &conv : cold->converters)
+            if (conv.convertType() == type)
+                return conv;
+    }
     return Converter();
 }
 
+inline const kF::Core::FlatVector<kF::Meta::Converter> &kF::Meta::Type::converters(void) const noexcept
+{
+    return cold().converters;
+}
+
 inline kF::Meta::Function kF::Meta::Type::findFunction(const HashedName name) const noexcept
 {
-    for (const auto &func : _desc->functions)
-        if (func.name() == name)
-            return func;
-    for (Function res; const auto &base : _desc->bases)
-        if (res = base.findFunction(name); res)
-            return res;
+    if (const auto cold = findCold(); !cold || (cold->functions.empty() && cold->bases.empty())) [[likely]]
+        return registerOnDemand() ? findFunction(name) : Function();
+    const auto &tables = memberTables();
+    const auto position = tables.functionIndex.find(name);
+
+    if (position != Internal::HashIndex::NullPosition) [[likely]]
+        return tables.functions[position];
     return Function();
 }
 
 inline kF::Meta::Data kF::Meta::Type::findData(const HashedName name) const noexcept
 {
-    for (const auto &data : _desc->datas)
-        if (data.name() == name)
-            return data;
-    for (Data res; const auto &base : _desc->bases)
-        if (res = base.findData(name); res)
-            return res;
+    if (const auto cold = findCold(); !cold || (cold->datas.empty() && cold->bases.empty())) [[likely]]
+        return registerOnDemand() ? findData(name) : Data();
+    const auto &tables = memberTables();
+    const auto position = tables.dataIndex.find(name);
+
+    if (position != Internal::HashIndex::NullPosition) [[likely]]
+        return tables.datas[position];
     return Data();
 }
 
 inline kF::Meta::Signal kF::Meta::Type::findSignal(const HashedName name) const noexcept
 {
-    for (const auto &signal : _desc->signals)
-        if (signal.name() == name)
-            return signal;
-    for (Signal res; const auto &base : _desc->bases)
-        if (res = base.findSignal(name); res)
-            return res;
+    if (const auto cold = findCold(); !cold || (cold->signals.empty() && cold->bases.empty())) [[likely]]
+        return registerOnDemand() ? findSignal(name) : Signal();
+    const auto &tables = memberTables();
+    const auto position = tables.signalIndex.find(name);
+
+    if (position != Internal::HashIndex::NullPosition) [[likely]]
+        return tables.signals[position];
     return Signal();
 }
 
+inline void kF::Meta::Type::flatten(void) const noexcept
+{
+    static_cast<void>(ancestorTable());
+    static_cast<void>(memberTables());
+}
+
+inline void kF::Meta::Type::releaseRetired(void) const noexcept
+{
+    if (const auto cold = findCold(); cold) {
+        cold->ancestors.releaseRetired();
+        cold->memberTables.releaseRetired();
+        cold->constructorMatches.releaseRetired();
+    }
+}
+
+inline const kF::Meta::Type::MemberTables &kF::Meta::Type::memberTables(void) const noexcept
+{
+    if (const auto tables = cold().memberTables.get(); tables && tables->generation == _MembersGeneration) [[likely]]
+        return *tables;
+    std::lock_guard lock(_PublishMutex);
+    return flattenMembers();
+}
+
+inline const kF::Meta::Type::MemberTables &kF::Meta::Type::flattenMembers(void) const noexcept
+{
+    auto &cold = this->cold();
+    const auto generation = _MembersGeneration.load(std::memory_order_acquire);
+
+    // Another thread may have published them while the lock was taken
+    if (const auto tables = cold.memberTables.get(); tables && tables->generation == generation)
+        return *tables;
+    MemberTables tables { .generation = generation };
+    // Duplicated names are all indexed, HashIndex always returns the first one inserted
+    const auto append = [](auto &members, auto &index, const auto &from) {
+        for (const auto member : from) {
+            index.insert(member.name(), static_cast<Internal::HashIndex::Position>(members.size()));
+            members.push(member);
+        }
+    };
+
+    append(tables.functions, tables.functionIndex, cold.functions);
+    append(tables.datas, tables.dataIndex, cold.datas);
+    append(tables.signals, tables.signalIndex, cold.signals);
+    for (const auto base : cold.bases) {
+        const auto &baseTables = base.flattenMembers();
+        append(tables.functions, tables.functionIndex, baseTables.functions);
+        append(tables.datas, tables.dataIndex, baseTables.datas);
+        append(tables.signals, tables.signalIndex, baseTables.signals);
+    }
+    return cold.memberTables.publish(std::move(tables));
+}
+
 inline kF::Meta::Constructor kF::Meta::Type::findConstructor(const std::vector<Type> &types) const noexcept
+{
+    return resolveConstructor(types.data(), types.size()).constructor;
+}
+
+inline kF::Meta::Type::ConstructorMatch kF::Meta::Type::resolveConstructor(const Type *types, const std::size_t count) const noexcept
+{
+    static_cast<void>(registerOnDemand());
+    auto &cold = this->cold();
+    const auto generation = _ConstructorsGeneration.load(std::memory_order_acquire);
+    const auto find = [types, count](const ConstructorMatches &matches, const Internal::HashIndex::Key key) {
+        return matches.index.find(key, [&matches, types, count](const auto position) {
+            const auto &entry = matches.entries[position];
+            if (entry.argsCount != count)
+                return false;
+            for (auto i = 0u; i != count; ++i)
+                if (matches.argTypes[entry.argsOffset + i] != types[i])
+                    return false;
+            return true;
+        });
+    };
+    auto key = static_cast<Internal::HashIndex::Key>(count);
+
+    for (auto i = 0u; i != count; ++i)
+        key = Internal::HashIndex::Combine(key, reinterpret_cast<std::uintptr_t>(types[i]._desc));
+    if (const auto matches = cold.constructorMatches.get(); matches && matches->generation == generation) [[likely]] {
+        if (const auto position = find(*matches, key); position != Internal::HashIndex::NullPosition) [[likely]]
+            return matches->entries[position].match;
+    }
+
+    // Scoring looks up converters, it must not run under the publication lock
+    ConstructorMatch match { .constructor = scoreConstructors(types, count), .isExact = true };
+    std::unique_ptr<Converter[]> converters;
+    for (auto i = 0u; i != count && match.constructor; ++i) {
+        if (const auto expectedType = match.constructor.argType(i); types[i] != expectedType) {
+            if (!converters)
+                converters = std::make_unique<Converter[]>(count);
+            converters[i] = types[i].findConverter(expectedType);
+            match.isExact = false;
+        }
+    }
+
+    // Matches of a generation are appended to its table, which is only replaced when the generation changes
+    std::lock_guard lock(_PublishMutex);
+    auto matches = cold.constructorMatches.edit();
+
+    // A resolution made before a registration is not cached, its converters are released with it
+    if (generation != _ConstructorsGeneration.load(std::memory_order_acquire)) [[unlikely]]
+        return ConstructorMatch { .constructor = match.constructor, .isExact = match.isExact };
+    else if (!matches || matches->generation != generation)
+        matches = &cold.constructorMatches.emplace(generation);
+    else if (const auto position = find(*matches, key); position != Internal::HashIndex::NullPosition)
+        return matches->entries[position].match;
+    match.converters = converters.get();
+    if (converters)
+        matches->converters.push(std::move(converters));
+    for (auto i = 0u; i != count; ++i)
+        matches->argTypes.push(types[i]);
+    // The entry must be published before being indexed
+    matches->entries.push(ConstructorMatches::Entry {
+        .match = match,
+        .argsOffset = static_cast<std::uint32_t>(matches->argTypes.size() - count),
+        .argsCount = static_cast<std::uint32_t>(count)
+    });
+    matches->index.insert(key, matches->entries.size() - 1u);
+    return match;
+}
+
+inline kF::Meta::Constructor kF::Meta::Type::scoreConstructors(const Type *types, const std::size_t count) const noexcept
 {
     Constructor preferred {};
     auto bestScore = 0u;
 
-    for (const auto ctor : _desc->constructors) {
+    for (const auto ctor : cold().constructors) {
         auto i = 0u, score = 0u;
-        if (types.size() != ctor.argsCount())
+        if (count != ctor.argsCount())
             continue;
-        for (const auto type : types) {
-            auto expectedType = ctor.argType(i);
+        for (; i != count; ++i) {
+            const auto type = types[i];
+            const auto expectedType = ctor.argType(i);
             if (type == expectedType)
                 ++score;
             else if (!type.findConverter(expectedType))
                 break;
-            ++i;
         }
         // We got a perfect match, return it
-        if (score == types.size())
+        if (score == count)
             return ctor;
         // We got a match but it requires conversion, store it but continue to check if there is a better match
-        else if (i == types.size() && bestScore < score) {
+        else if (i == count && (!preferred || bestScore < score)) {
             bestScore = score;
             preferred = ctor;
         }
@@ -272,15 +551,55 @@ inline kF::Meta::Constructor kF::Meta::Type::findConstructor(const std::vector<T
     return preferred;
 }
 
+inline void kF::Meta::Type::validateMembers(void) const noexcept_ndebug
+{
+    const auto cold = findCold();
+
+    if (!cold)
+        return;
+    // Each list is copied and sorted once, duplicates end up adjacent
+    [[maybe_unused]] const auto isUnique = [](const auto &from, const auto &key) {
+        std::vector<decltype(key(*from.begin()))> keys;
+        keys.reserve(from.size());
+        for (const auto &member : from)
+            keys.push_back(key(member));
+        std::sort(keys.begin(), keys.end());
+        return std::adjacent_find(keys.begin(), keys.end()) == keys.end();
+    };
+    [[maybe_unused]] const auto argTypes = [](const Constructor ctor) {
+        std::vector<const Descriptor *> types(ctor.argsCount());
+        for (auto i = 0u; i != types.size(); ++i)
+            types[i] = ctor.argType(i)._desc;
+        return types;
+    };
+
+    kFAssert(isUnique(cold->bases, [](const Type base) { return base._desc; }),
+        throw std::logic_error("Meta::Type::validateMembers: Base already registered"));
+    kFAssert(isUnique(cold->constructors, argTypes),
+        throw std::logic_error("Meta::Type::validateMembers: Constructor already registered"));
+    kFAssert(isUnique(cold->converters, [](const Converter converter) { return converter.convertType()._desc; }),
+        throw std::logic_error("Meta::Type::validateMembers: Converter already registered"));
+    kFAssert(isUnique(cold->functions, [](const Function function) { return function.name(); }),
+        throw std::logic_error("Meta::Type::validateMembers: Function already registered"));
+    kFAssert(isUnique(cold->datas, [](const Data data) { return data.name(); }),
+        throw std::logic_error("Meta::Type::validateMembers: Data already registered"));
+    kFAssert(isUnique(cold->signals, [](const Signal signal) { return signal.signalPtr(); }),
+        throw std::logic_error("Meta::Type::validateMembers: Signal already registered"));
+}
+
 template<auto SignalPtr>
 kF::Meta::Signal kF::Meta::Type::findSignal(void) const noexcept
 {
     const auto signalPtr = Internal::GetFunctionIdentifier<SignalPtr>();
 
-    for (const auto &signal : _desc->signals)
+    const auto cold = findCold();
+
+    if (!cold) [[likely]]
+        return registerOnDemand() ? findSignal<SignalPtr>() : Signal();
+    for (const auto &signal : cold->signals)
         if (signal.signalPtr() == signalPtr)
             return signal;
-    for (Signal res; const auto &base : _desc->bases)
+    for (Signal res; const auto &base : cold->bases)
         if (res = base.findSignal<SignalPtr>(); res)
             return res;
     return Signal();
@@ -291,41 +610,24 @@ kF::Meta::Constructor kF::Meta::Type::findConstructor(void) const noexcept
 {
     using Decomposer = Internal::FunctionDecomposerHelper<void(*)(Args...)>;
 
-    Constructor preferred {};
-    auto bestScore = 0u;
+    std::array<Type, sizeof...(Args)> types {};
 
-    for (const auto ctor : _desc->constructors) {
-        auto i = 0u, score = 0u;
-        if (sizeof...(Args) != ctor.argsCount())
-            continue;
-        while (i < sizeof...(Args)) {
-            auto type = Decomposer::ArgType(i);
-            auto expectedType = ctor.argType(i);
-            if (type == expectedType)
-                ++score;
-            else if (!type.findConverter(expectedType))
-                break;
-            ++i;
-        }
-        // We got a perfect match, return it
-        if (score == sizeof...(Args))
-            return ctor;
-        // We got a match but it requires conversion, store it but continue to check if there is a better match
-        else if (i == sizeof...(Args) && bestScore < score) {
-            bestScore = score;
-            preferred = ctor;
-        }
-    }
-    return preferred;
+    for (auto i = 0u; i != sizeof...(Args); ++i)
+        types[i] = Decomposer::ArgType(i);
+    return resolveConstructor(types.data(), types.size()).constructor;
 }
 
 inline void kF::Meta::Type::clear(void)
 {
     _desc->name = 0;
-    _desc->bases.clear();
-    _desc->constructors.clear();
-    _desc->converters.clear();
-    _desc->functions.clear();
-    _desc->datas.clear();
-    _desc->signals.clear();
+    _desc->ordinal = Ordinal::Null;
+    // The cold descriptor holds every registered meta-data, it stays allocated but is emptied
+    if (const auto cold = findCold(); cold) {
+        const auto next = cold->next;
+        *cold = ColdDescriptor {};
+        cold->next = next;
+    }
+    InvalidateAncestors();
+    InvalidateMembers();
+    InvalidateConverters();
 }
\ No newline at end of file
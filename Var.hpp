@@ -5,20 +5,70 @@
 
 #pragma once
 
+#include <bit>
 #include <cstring>
 
 #include "Type.hpp"
+#include "VarAllocator.hpp"
+
+namespace kF::Meta::Internal
+{
+    /** @brief A bunch of enum helpers for better template readability */
+    enum class UseSmallOptimization     : bool { No = false, Yes = true };
+    enum class ShouldResetMembers       : bool { No = false, Yes = true };
+    enum class ShouldCheckIfAssignable  : bool { No = false, Yes = true };
+    enum class ShouldDestructInstance   : bool { No = false, Yes = true };
+
+    /** @brief Helper to know if a type is any BasicVar instantiation */
+    template<typename Type>
+    struct IsVarHelper : std::false_type {};
+
+    template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+    struct IsVarHelper<BasicVar<InlineSize, Alignment, Allocator>> : std::true_type {};
+
+    template<typename Type>
+    constexpr bool IsVar = IsVarHelper<std::remove_cvref_t<Type>>::value;
+
+    /** @brief Size of the BasicVar members preceding its inline storage */
+    constexpr std::size_t VarHeaderSize = Core::CacheLineQuarterSize;
+
+    /**
+     * @brief Alignment of a BasicVar, the smallest power of 2 holding its header and its inline storage so it never straddles two cache lines
+     *
+     * Instantiations greater than a cache line keep their natural alignment rather than being padded to the next power of 2
+     */
+    template<std::size_t InlineSize>
+    constexpr std::size_t VarAlignment = VarHeaderSize + InlineSize <= Core::CacheLineSize
+        ? std::bit_ceil(VarHeaderSize + InlineSize) : alignof(void *);
+}
 
 /**
- * @brief Var is used as a wrapper for any type
+ * @brief BasicVar is used as a wrapper for any type
  *
  * It can hold a value, a reference or a rvalue reference.
- * Value that are <= to size of a pointer are cheaply copied.
+ * Values that fit in 'InlineSize' bytes with at most 'Alignment' are stored inline, others on the heap using 'Allocator'.
+ * 'Var' is the instantiation using the default inline size, others are converted to it (and back) by value.
  */
-class alignas(kF::Meta::Internal::VarSmallOptimizationSize > kF::Core::CacheLineQuarterSize ? kF::Core::CacheLineSize : kF::Core::CacheLineHalfSize)
-    kF::Var
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+class alignas(Alignment) alignas(kF::Meta::Internal::VarAlignment<InlineSize>) kF::BasicVar
 {
 public:
+    static_assert(InlineSize >= sizeof(void *), "BasicVar inline storage must be able to store a pointer");
+    static_assert(Alignment >= alignof(void *) && (Alignment & (Alignment - 1u)) == 0u, "BasicVar alignment must be a power of 2 greater than pointer's");
+
+    /** @brief Size of the inline storage */
+    static constexpr std::size_t SmallOptimizationSize = InlineSize;
+
+    /** @brief Alignment of the inline storage */
+    static constexpr std::size_t SmallOptimizationAlignment = Alignment;
+
+    /** @brief Allocator of heap stored values */
+    using AllocatorType = Allocator;
+
+    /** @brief Check at compile time if a type is stored inline */
+    template<typename Type>
+    static constexpr bool IsSmallOptimizedType = Meta::Internal::IsVarSmallOptimized<Type, InlineSize, Alignment>;
+
     /**
      * @brief Describes how the internal instance is stored
      *
@@ -37,53 +87,73 @@ public:
     union Cache
     {
         void *ptr;
-        std::byte memory[Meta::Internal::VarSmallOptimizationSize];
+        alignas(Alignment) std::byte memory[InlineSize];
     };
 
     /** @brief A bunch of enum helpers for better template readability */
-    enum class UseSmallOptimization     : bool { No = false, Yes = true };
-    enum class ShouldResetMembers       : bool { No = false, Yes = true };
-    enum class ShouldCheckIfAssignable  : bool { No = false, Yes = true };
-    enum class ShouldDestructInstance   : bool { No = false, Yes = true };
+    using UseSmallOptimization = Meta::Internal::UseSmallOptimization;
+    using ShouldResetMembers = Meta::Internal::ShouldResetMembers;
+    using ShouldCheckIfAssignable = Meta::Internal::ShouldCheckIfAssignable;
+    using ShouldDestructInstance = Meta::Internal::ShouldDestructInstance;
 
     /** @brief Assigns a type value to a Var */
     template<typename Type>
-    static Var Assign(Type &&type)
-        { Var tmp; tmp.assign<Type, ShouldDestructInstance::No>(std::forward<Type>(type)); return tmp; }
+    static BasicVar Assign(Type &&type)
+        { BasicVar tmp; tmp.assign<Type, ShouldDestructInstance::No>(std::forward<Type>(type)); return tmp; }
 
     /** @brief Emplaces a type value to a Var */
     template<typename Type, typename ...Args>
-    static Var Emplace(Args &&...args)
-        { Var tmp; tmp.emplace<Type, ShouldDestructInstance::No>(std::forward<Args>(args)...); return tmp; }
+    static BasicVar Emplace(Args &&...args)
+        { BasicVar tmp; tmp.emplace<Type, ShouldDestructInstance::No>(std::forward<Args>(args)...); return tmp; }
 
     /** @brief Emplaces a type value to a Var */
     template<typename ...Args>
-    static Var Construct(const HashedName name, Args &&...args)
-        { Var tmp; tmp.construct<ShouldDestructInstance::No>(name, std::forward<Args>(args)...); return tmp; }
+    static BasicVar Construct(const HashedName name, Args &&...args)
+        { BasicVar tmp; tmp.construct<ShouldDestructInstance::No>(name, std::forward<Args>(args)...); return tmp; }
 
     /** @brief Default constructor, instance is empty */
-    Var(void) noexcept = default;
+    BasicVar(void) noexcept = default;
 
     /** @brief Copy constructor, deep copy ! */
-    Var(const Var &other) { deepCopy<ShouldCheckIfAssignable::No, ShouldDestructInstance::No>(other); }
+    BasicVar(const BasicVar &other) { deepCopy<ShouldCheckIfAssignable::No, ShouldDestructInstance::No>(other); }
 
     /** @brief Move constructor */
-    Var(Var &&other) { move<ShouldDestructInstance::No>(other); }
+    BasicVar(BasicVar &&other) { move<ShouldDestructInstance::No>(other); }
+
+    /** @brief Copy constructor from another instantiation, deep copy ! */
+    template<std::size_t OtherInlineSize, std::size_t OtherAlignment, typename OtherAllocator>
+    explicit BasicVar(const BasicVar<OtherInlineSize, OtherAlignment, OtherAllocator> &other)
+        { deepCopy<ShouldCheckIfAssignable::No, ShouldDestructInstance::No>(other); }
+
+    /** @brief Move constructor from another instantiation, the value is moved inline if it fits */
+    template<std::size_t OtherInlineSize, std::size_t OtherAlignment, typename OtherAllocator>
+    explicit BasicVar(BasicVar<OtherInlineSize, OtherAlignment, OtherAllocator> &&other)
+        { move<ShouldDestructInstance::No>(other); }
 
     /** @brief Emplace constructor */
-    template<typename Type, std::enable_if_t<!std::is_same_v<std::remove_cvref_t<Type>, Var>>* = nullptr>
-    Var(Type &&value)
+    template<typename Type, std::enable_if_t<!Meta::Internal::IsVar<Type>>* = nullptr>
+    BasicVar(Type &&value)
         noexcept_constructible(std::remove_cvref_t<Type>, Type)
         { emplace<std::remove_cvref_t<Type>, ShouldDestructInstance::No>(std::forward<Type>(value)); }
 
     /** @brief If not empty, will destruct the internal value */
-    ~Var(void) { release<ShouldResetMembers::No>(); }
+    ~BasicVar(void) { release<ShouldResetMembers::No>(); }
 
     /** @brief Copy assignment, deep copy ! */
-    Var &operator=(const Var &other) { deepCopy<ShouldCheckIfAssignable::Yes, ShouldDestructInstance::No>(other); return *this; }
+    BasicVar &operator=(const BasicVar &other) { deepCopy<ShouldCheckIfAssignable::Yes, ShouldDestructInstance::Yes>(other); return *this; }
 
     /** @brief Move assignment, either call constructor or move pointers if not small optimized */
-    Var &operator=(Var &&other) { move<ShouldDestructInstance::Yes>(other); return *this; }
+    BasicVar &operator=(BasicVar &&other) { move<ShouldDestructInstance::Yes>(other); return *this; }
+
+    /** @brief Copy assignment from another instantiation, deep copy ! */
+    template<std::size_t OtherInlineSize, std::size_t OtherAlignment, typename OtherAllocator>
+    BasicVar &operator=(const BasicVar<OtherInlineSize, OtherAlignment, OtherAllocator> &other)
+        { deepCopy<ShouldCheckIfAssignable::Yes, ShouldDestructInstance::Yes>(other); return *this; }
+
+    /** @brief Move assignment from another instantiation, the value is moved inline if it fits */
+    template<std::size_t OtherInlineSize, std::size_t OtherAlignment, typename OtherAllocator>
+    BasicVar &operator=(BasicVar<OtherInlineSize, OtherAlignment, OtherAllocator> &&other)
+        { move<ShouldDestructInstance::Yes>(other); return *this; }
 
     /** @brief Destruct the instance and its internal memory */
     template<ShouldResetMembers ResetMembers = ShouldResetMembers::Yes>
@@ -98,8 +168,9 @@ public:
     void assign(Type &&other);
 
     /** @brief Deep copy another variable */
-    template<ShouldCheckIfAssignable CheckIfAssignable = ShouldCheckIfAssignable::Yes, ShouldDestructInstance DestructInstance = ShouldDestructInstance::Yes>
-    void deepCopy(const Var &other);
+    template<ShouldCheckIfAssignable CheckIfAssignable = ShouldCheckIfAssignable::Yes, ShouldDestructInstance DestructInstance = ShouldDestructInstance::Yes,
+            std::size_t OtherInlineSize, std::size_t OtherAlignment, typename OtherAllocator>
+    void deepCopy(const BasicVar<OtherInlineSize, OtherAlignment, OtherAllocator> &other);
 
     /** @brief Emplaces a type into the current instance */
     template<typename Type, ShouldDestructInstance DestructInstance = ShouldDestructInstance::Yes, typename ...Args>
@@ -131,6 +202,21 @@ public:
     /** @brief Check if type is void */
     [[nodiscard]] bool isVoid(void) const noexcept { return _type.isVoid(); }
 
+    /** @brief Get the capacity of the owned heap block (0 if there is none) */
+    [[nodiscard]] std::uint32_t capacity(void) const noexcept { return _capacity; }
+
+
+    /**
+     * @brief Ensures the heap block can hold values up to 'capacity' bytes, moving the current value into it
+     *
+     * Later values that fit the block are stored in it, even small ones, until 'shrinkToFit' or 'release'.
+     * Has no effect when the instance holds a reference.
+     */
+    void reserveCapacity(const std::uint32_t capacity, const std::size_t alignment = alignof(std::max_align_t));
+
+    /** @brief Releases the unused heap memory, values that fit inline are moved back into the instance */
+    void shrinkToFit(void);
+
 
     /** @brief Retreive opaque internal data */
     [[nodiscard]] void *data(void) const noexcept
@@ -174,10 +260,10 @@ public:
 
     /** @brief Tries to create an opaque converted value to given type */
     template<typename To>
-    [[nodiscard]] Var convertOpaque(void) const { return convertOpaque(Meta::Factory<To>::Resolve()); }
+    [[nodiscard]] BasicVar convertOpaque(void) const { return convertOpaque(Meta::Factory<To>::Resolve()); }
 
     /** @brief Tries to get an opaque converted value of given meta type name */
-    [[nodiscard]] Var convertOpaque(const Meta::Type type) const;
+    [[nodiscard]] BasicVar convertOpaque(const Meta::Type type) const;
 
     /** @brief Tries to convert internal directly to given type (If impossible, will throw in debug or crash in release) */
     template<typename To>
@@ -188,16 +274,16 @@ public:
 
 
     /** @brief Various opaque operators helpers */
-    [[nodiscard]] Var operator+(const Var &rhs) const;
-    [[nodiscard]] Var operator-(const Var &rhs) const;
-    [[nodiscard]] Var operator*(const Var &rhs) const;
-    [[nodiscard]] Var operator/(const Var &rhs) const;
-    [[nodiscard]] Var operator%(const Var &rhs) const;
-    Var &operator+=(const Var &rhs);
-    Var &operator-=(const Var &rhs);
-    Var &operator*=(const Var &rhs);
-    Var &operator/=(const Var &rhs);
-    Var &operator%=(const Var &rhs);
+    [[nodiscard]] BasicVar operator+(const BasicVar &rhs) const;
+    [[nodiscard]] BasicVar operator-(const BasicVar &rhs) const;
+    [[nodiscard]] BasicVar operator*(const BasicVar &rhs) const;
+    [[nodiscard]] BasicVar operator/(const BasicVar &rhs) const;
+    [[nodiscard]] BasicVar operator%(const BasicVar &rhs) const;
+    BasicVar &operator+=(const BasicVar &rhs);
+    BasicVar &operator-=(const BasicVar &rhs);
+    BasicVar &operator*=(const BasicVar &rhs);
+    BasicVar &operator/=(const BasicVar &rhs);
+    BasicVar &operator%=(const BasicVar &rhs);
 
 
     /** @brief Various non-opaque operators helpers */
@@ -222,6 +308,9 @@ public:
     void reserve(const Meta::Type type) noexcept_ndebug;
 
 private:
+    template<std::size_t OtherInlineSize, std::size_t OtherAlignment, typename OtherAllocator>
+    friend class BasicVar;
+
     Meta::Type _type {};
     StorageType _storageType { StorageType::Undefined };
     std::uint32_t _capacity { 0 };
@@ -230,13 +319,41 @@ private:
     /** @brief Unsafe reference getter used internally */
     [[nodiscard]] void *&dataRef(void) noexcept { return _data.ptr; }
 
+    /** @brief Get the instance as a default Var, other instantiations are passed as constant reference */
+    [[nodiscard]] decltype(auto) asVar(void) const noexcept
+    {
+        if constexpr (std::is_same_v<BasicVar, Var>)
+            return static_cast<const Var &>(*this);
+        else {
+            Var var;
+            var._type = _type;
+            var._storageType = Var::StorageType::ReferenceConstant;
+            var.dataRef() = data();
+            return var;
+        }
+    }
+
+    /** @brief Copy a trivially copyable value of another instance into the reserved storage */
+    template<std::size_t OtherInlineSize, std::size_t OtherAlignment, typename OtherAllocator>
+    void copyTrivial(const BasicVar<OtherInlineSize, OtherAlignment, OtherAllocator> &other) noexcept;
+
+    /** @brief Move a value to another location and destruct the source, trivially relocatable types are copied */
+    static void Relocate(const Meta::Type type, void * const to, void * const from);
+
     /** @brief Move helper */
-    template<ShouldDestructInstance DestructInstance = ShouldDestructInstance::Yes>
-    void move(Var &other);
+    template<ShouldDestructInstance DestructInstance = ShouldDestructInstance::Yes, std::size_t OtherInlineSize, std::size_t OtherAlignment, typename OtherAllocator>
+    void move(BasicVar<OtherInlineSize, OtherAlignment, OtherAllocator> &other);
 
-    /** @brief Allocate a given capacity on the heap */
+    /** @brief Construct a reserved instance with a meta constructor */
+    template<typename ...Args>
+    void constructCustom(void *ptr, Args &&...args);
+
+    /** @brief Allocate a given capacity on the heap, the owned block is reused if it is large and aligned enough */
     void alloc(const std::uint32_t capacity) noexcept_ndebug;
 
+    /** @brief Check if the owned heap block can store a value of given size and alignment */
+    [[nodiscard]] bool canReuseAlloc(const std::uint32_t size, const std::size_t alignment) const noexcept;
+
     /** @brief Release the current allocation if there is any */
     template<ShouldDestructInstance DestructInstance>
     void releaseAlloc(void) noexcept;
@@ -244,4 +361,8 @@ private:
     [[nodiscard]] static std::string TypeToString(const Meta::Type type) noexcept;
 };
 
-static_assert(sizeof(kF::Var) - kF::Meta::Internal::VarSmallOptimizationSize == kF::Core::CacheLineQuarterSize, "Var data must take the qurater of a cacheline");
\ No newline at end of file
+static_assert(sizeof(kF::Var) - kF::Var::SmallOptimizationSize == kF::Core::CacheLineQuarterSize, "Var data must take the qurater of a cacheline");
+static_assert(sizeof(kF::BasicVar<16, 16>) == 32u, "BasicVar<16> must take half a cacheline");
+static_assert(sizeof(kF::BasicVar<24, 16>) == 64u && sizeof(kF::BasicVar<32, 16>) == 64u && sizeof(kF::BasicVar<48, 16>) == 64u,
+    "BasicVar<24>, BasicVar<32> and BasicVar<48> must take a single cacheline");
+static_assert(sizeof(kF::BasicVar<64, 16>) == 80u, "BasicVar<64> must not be padded to two cachelines");
\ No newline at end of file
@@ -3,19 +3,23 @@
  * @ Description: Variable
  */
 
-template<kF::Var::ShouldResetMembers ResetMembers>
-inline void kF::Var::release(void)
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+template<kF::Meta::Internal::ShouldResetMembers ResetMembers>
+inline void kF::BasicVar<InlineSize, Alignment, Allocator>::release(void)
 {
     destruct<ResetMembers>();
     if (_capacity) {
-        Core::Utils::AlignedFree(dataRef());
+        // Monotonic blocks are released with their resource
+        if constexpr (!Allocator::IsMonotonic)
+            Allocator::Deallocate(dataRef(), _capacity);
         if constexpr (ResetMembers == ShouldResetMembers::Yes)
             _capacity = 0u;
     }
 }
 
-template<typename Type, kF::Var::ShouldDestructInstance DestructInstance>
-inline void kF::Var::assign(Type &&other)
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+template<typename Type, kF::Meta::Internal::ShouldDestructInstance DestructInstance>
+inline void kF::BasicVar<InlineSize, Alignment, Allocator>::assign(Type &&other)
 {
     using DirectType = decltype(other);
     using FlatType = std::remove_cvref_t<Type>;
@@ -24,7 +28,7 @@ inline void kF::Var::assign(Type &&other)
 
     if constexpr (DestructInstance == ShouldDestructInstance::Yes)
         destruct<ShouldResetMembers::No>();
-    if constexpr (std::is_same_v<FlatType, Var>) {
+    if constexpr (Meta::Internal::IsVar<FlatType>) {
         if constexpr (!std::is_lvalue_reference_v<DirectType>) {
             move(other);
             return;
@@ -49,40 +53,67 @@ inline void kF::Var::assign(Type &&other)
     _storageType = ConstexprTernary(IsConst, StorageType::ReferenceConstant, StorageType::ReferenceVolatile);
 }
 
-template<kF::Var::ShouldCheckIfAssignable CheckIfAssignable, kF::Var::ShouldDestructInstance DestructInstance>
-inline void kF::Var::deepCopy(const Var &other)
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+template<kF::Meta::Internal::ShouldCheckIfAssignable CheckIfAssignable, kF::Meta::Internal::ShouldDestructInstance DestructInstance,
+        std::size_t OtherInlineSize, std::size_t OtherAlignment, typename OtherAllocator>
+inline void kF::BasicVar<InlineSize, Alignment, Allocator>::deepCopy(const BasicVar<OtherInlineSize, OtherAlignment, OtherAllocator> &other)
 {
     if (!other) [[unlikely]] {
         destruct<ShouldResetMembers::Yes>();
         return;
     }
-    const auto otherType = other.type();
+    const Meta::Type otherType = other.type();
     kFAssert(otherType.isCopyAssignable(),
         throw std::runtime_error("Var::deepCopy: Copy construct is not supported on type"));
     if constexpr (CheckIfAssignable == ShouldCheckIfAssignable::Yes) {
-        if (*this && type().typeID() == otherType.typeID()) {
-            if (otherType.isSmallOptimized()) {
-                otherType.copyAssign(data<UseSmallOptimization::Yes>(), const_cast<void *>(other.data()));
-                _storageType = StorageType::ValueOptimized;
-            } else {
-                otherType.copyAssign(data<UseSmallOptimization::No>(), const_cast<void *>(other.data()));
-                _storageType = StorageType::Value;
-            }
+        // Only an owned value is assigned in place, a reference is released rather than written through
+        if ((_storageType == StorageType::Value || _storageType == StorageType::ValueOptimized) && type().typeID() == otherType.typeID()) {
+            // The storage is kept as is, a small value may live in a reused heap block
+            if (otherType.isTriviallyCopyable()) [[likely]]
+                copyTrivial(other);
+            else
+                otherType.copyAssign(data(), const_cast<void *>(other.data()));
             return;
         }
     }
-    if (otherType.isSmallOptimized()) {
-        reserve<UseSmallOptimization::Yes, DestructInstance>(otherType);
-        other.type().copyConstruct(data<UseSmallOptimization::Yes>(), const_cast<void *>(other.data()));
-    } else {
-        reserve<UseSmallOptimization::No, DestructInstance>(otherType);
-        otherType.copyConstruct(data<UseSmallOptimization::No>(), const_cast<void *>(other.data()));
+    reserve<DestructInstance>(otherType);
+    if (otherType.isTriviallyCopyable()) [[likely]]
+        copyTrivial(other);
+    else
+        otherType.copyConstruct(data(), const_cast<void *>(other.data()));
+}
+
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+template<std::size_t OtherInlineSize, std::size_t OtherAlignment, typename OtherAllocator>
+inline void kF::BasicVar<InlineSize, Alignment, Allocator>::copyTrivial(const BasicVar<OtherInlineSize, OtherAlignment, OtherAllocator> &other) noexcept
+{
+    if constexpr (OtherInlineSize >= InlineSize) {
+        // Whole inline storages are copied at once, the size is known at compile time
+        if (isSmallOptimizedValue() && other.isSmallOptimizedValue()) [[likely]] {
+            std::memcpy(data<UseSmallOptimization::Yes>(), other.template data<UseSmallOptimization::Yes>(), InlineSize);
+            return;
+        }
     }
+    std::memcpy(data(), other.data(), other.type().typeSize());
 }
 
-template<typename UnarrangedType, kF::Var::ShouldDestructInstance DestructInstance, typename ...Args>
-inline void kF::Var::emplace(Args &&...args)
-    noexcept(DestructInstance == kF::Var::ShouldDestructInstance::No && nothrow_constructible(UnarrangedType, Args...))
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+inline void kF::BasicVar<InlineSize, Alignment, Allocator>::Relocate(const Meta::Type type, void * const to, void * const from)
+{
+    if (type.isTriviallyRelocatable()) [[likely]]
+        std::memcpy(to, from, type.typeSize());
+    else {
+        kFAssert(type.isMoveConstructible(),
+            throw std::runtime_error("Var::relocate: Move construct is not supported on type"));
+        type.moveConstruct(to, from);
+        type.destruct(from);
+    }
+}
+
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+template<typename UnarrangedType, kF::Meta::Internal::ShouldDestructInstance DestructInstance, typename ...Args>
+inline void kF::BasicVar<InlineSize, Alignment, Allocator>::emplace(Args &&...args)
+    noexcept(DestructInstance == kF::Meta::Internal::ShouldDestructInstance::No && nothrow_constructible(UnarrangedType, Args...))
 {
     using Type = typename Meta::Internal::ArrangeType<UnarrangedType>::Type;
 
@@ -92,7 +123,15 @@ inline void kF::Var::emplace(Args &&...args)
     if constexpr (std::is_same_v<Type, void>) {
         _storageType = StorageType::Undefined;
         releaseAlloc<DestructInstance>();
-    } else if constexpr (Meta::Internal::IsVarSmallOptimized<Type>) {
+    } else if constexpr (Meta::Internal::IsVarSmallOptimized<Type, InlineSize, Alignment>) {
+        if constexpr (DestructInstance == ShouldDestructInstance::Yes) {
+            // An owned heap block is kept for the next values rather than released
+            if (_capacity && canReuseAlloc(sizeof(Type), alignof(Type))) [[unlikely]] {
+                _storageType = StorageType::Value;
+                new (data<UseSmallOptimization::No>()) Type(std::forward<Args>(args)...);
+                return;
+            }
+        }
         _storageType = StorageType::ValueOptimized;
         releaseAlloc<DestructInstance>();
         new (data<UseSmallOptimization::Yes>()) Type(std::forward<Args>(args)...);
@@ -103,53 +142,114 @@ inline void kF::Var::emplace(Args &&...args)
     }
 }
 
-template<kF::Var::ShouldDestructInstance DestructInstance, typename ...Args>
-inline void kF::Var::construct(const HashedName name, Args &&...args)
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+template<kF::Meta::Internal::ShouldDestructInstance DestructInstance, typename ...Args>
+inline void kF::BasicVar<InlineSize, Alignment, Allocator>::construct(const HashedName name, Args &&...args)
 {
     auto type = Meta::Resolver::FindType(name);
 
     kFAssert(type,
         throw std::runtime_error("Var::construct: Unknown type name"));
-    void *ptr;
-    if (type.isSmallOptimized()) {
-        reserve<UseSmallOptimization::Yes, DestructInstance>(type);
-        ptr = data<UseSmallOptimization::Yes>();
-    } else {
-        reserve<UseSmallOptimization::No, DestructInstance>(type);
-        ptr = data<UseSmallOptimization::No>();
-    }
+    reserve<DestructInstance>(type);
+    void * const ptr = data();
     if constexpr (sizeof...(Args) == 0) {
         kFAssert(_type.isDefaultConstructible(),
             throw std::runtime_error("Var::construct: Given type is not default constructible"));
         _type.defaultConstruct(ptr);
-    } else if (sizeof...(Args) == 1 && (_type.typeID() == typeid(std::tuple_element_t<0, std::tuple<Args...>>))) {
-        if constexpr (std::is_lvalue_reference_v<std::tuple_element_t<0, std::tuple<Args...>>>) {
-            kFAssert(_type.isCopyConstructible(),
-                throw std::runtime_error("Var::construct: Given type is not copy constructible"));
-            _type.copyConstruct(ptr, &args...);
-        } else {
-            kFAssert(_type.isMoveConstructible(),
-                throw std::runtime_error("Var::construct: Given type is not move constructible"));
-            _type.moveConstruct(ptr, &args...);
+        return;
+    } else if constexpr (sizeof...(Args) == 1) {
+        if (_type.typeID() == typeid(std::tuple_element_t<0, std::tuple<Args...>>)) {
+            if constexpr (std::is_lvalue_reference_v<std::tuple_element_t<0, std::tuple<Args...>>>) {
+                kFAssert(_type.isCopyConstructible(),
+                    throw std::runtime_error("Var::construct: Given type is not copy constructible"));
+                _type.copyConstruct(ptr, const_cast<void *>(static_cast<const void *>(&args))...);
+            } else {
+                kFAssert(_type.isMoveConstructible(),
+                    throw std::runtime_error("Var::construct: Given type is not move constructible"));
+                _type.moveConstruct(ptr, const_cast<void *>(static_cast<const void *>(&args))...);
+            }
+            return;
         }
-    } else // Constructor detector
-        throw std::runtime_error("Custom constructors not handled now");
+    }
+    if constexpr (sizeof...(Args) != 0)
+        constructCustom(ptr, std::forward<Args>(args)...);
 }
 
-template<kF::Var::ShouldResetMembers ResetMembers>
-inline void kF::Var::destruct(void)
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+template<typename ...Args>
+inline void kF::BasicVar<InlineSize, Alignment, Allocator>::constructCustom(void *ptr, Args &&...args)
+{
+    static_assert(sizeof...(Args) <= 64, "Var::construct: Too many arguments");
+
+    constexpr std::uint64_t MovableArgs = [] {
+        std::uint64_t mask = 0u, bit = 1u;
+        ((mask |= std::is_lvalue_reference_v<Args> ? 0u : bit, bit <<= 1u), ...);
+        return mask;
+    }();
+    const Meta::Type argTypes[] { Meta::Factory<Args>::Resolve()... };
+    const auto match = _type.resolveConstructor(argTypes, sizeof...(Args));
+
+    // The storage is reserved but nothing is constructed, the instance must be reset on failure
+    const auto fail = [this] {
+        _type = Meta::Type();
+        _storageType = StorageType::Undefined;
+    };
+    if (!match.constructor) [[unlikely]] {
+        fail();
+        throw std::runtime_error("Var::construct: No constructor matches given arguments");
+    }
+    try {
+        if (match.isExact) [[likely]] {
+            void * const arguments[] { const_cast<void *>(static_cast<const void *>(&args))... };
+            match.constructor.invokeExact(ptr, arguments, MovableArgs);
+        } else if (match.converters) [[likely]] {
+            // Arguments of another type are converted by the converters resolved with the match, then moved into the constructor
+            Var converted[sizeof...(Args)];
+            void *arguments[] { const_cast<void *>(static_cast<const void *>(&args))... };
+            auto movableArgs = MovableArgs;
+            for (auto i = 0u; i != sizeof...(Args); ++i) {
+                const auto converter = match.converters[i];
+                if (!converter)
+                    continue;
+                auto &value = converted[i];
+                value.reserve<ShouldDestructInstance::No>(converter.convertType());
+                try {
+                    converter.invoke(arguments[i], value.data());
+                } catch (...) {
+                    // Nothing was constructed into the reserved storage
+                    value._type = Meta::Type();
+                    value._storageType = Var::StorageType::Undefined;
+                    throw;
+                }
+                arguments[i] = value.data();
+                movableArgs |= 1ull << i;
+            }
+            match.constructor.invokeExact(ptr, arguments, movableArgs);
+        } else if (!match.constructor.invoke(ptr, std::forward<Args>(args)...)) [[unlikely]]
+            throw std::runtime_error("Var::construct: Constructor failed");
+    } catch (...) {
+        fail();
+        throw;
+    }
+}
+
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+template<kF::Meta::Internal::ShouldResetMembers ResetMembers>
+inline void kF::BasicVar<InlineSize, Alignment, Allocator>::destruct(void)
 {
     if (!_type) [[unlikely]]
         return;
-    switch (_storageType) {
-    case StorageType::Value:
-        _type.destruct(data<UseSmallOptimization::No>());
-        break;
-    case StorageType::ValueOptimized:
-        _type.destruct(data<UseSmallOptimization::Yes>());
-        break;
-    default:
-        break;
+    if (!_type.isTriviallyDestructible()) {
+        switch (_storageType) {
+        case StorageType::Value:
+            _type.destruct(data<UseSmallOptimization::No>());
+            break;
+        case StorageType::ValueOptimized:
+            _type.destruct(data<UseSmallOptimization::Yes>());
+            break;
+        default:
+            break;
+        }
     }
     if constexpr (ResetMembers == ShouldResetMembers::Yes) {
         _type = Meta::Type();
@@ -157,8 +257,9 @@ inline void kF::Var::destruct(void)
     }
 }
 
-template<kF::Var::UseSmallOptimization IsSmallOptimized>
-inline void *kF::Var::data(void) const noexcept
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+template<kF::Meta::Internal::UseSmallOptimization IsSmallOptimized>
+inline void *kF::BasicVar<InlineSize, Alignment, Allocator>::data(void) const noexcept
 {
     if constexpr (IsSmallOptimized == UseSmallOptimization::Yes)
         return const_cast<void *>(reinterpret_cast<const void *>(&_data.memory));
@@ -166,61 +267,75 @@ inline void *kF::Var::data(void) const noexcept
         return const_cast<void *>(_data.ptr);
 }
 
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
 template<typename Type>
-inline Type &kF::Var::cast(void) noexcept_ndebug
+inline Type &kF::BasicVar<InlineSize, Alignment, Allocator>::cast(void) noexcept_ndebug
 {
-    kFAssert(isCastAble<Type>(),
+    const auto ptr = tryCast<Type>();
+
+    kFAssert(ptr,
         throw std::runtime_error("Var::cast: Invalid cast from type '" + TypeToString(type())
                 + "' to '" + TypeToString(Meta::Factory<Type>::Resolve())));
-    return as<Type>();
+    return *ptr;
 }
 
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
 template<typename Type>
-inline const Type &kF::Var::cast(void) const noexcept_ndebug
+inline const Type &kF::BasicVar<InlineSize, Alignment, Allocator>::cast(void) const noexcept_ndebug
 {
-    kFAssert(isCastAble<Type>(),
+    const auto ptr = tryCast<Type>();
+
+    kFAssert(ptr,
         throw std::runtime_error("Var::cast: Invalid cast from type '" + TypeToString(type())
                 + "' to '" + TypeToString(Meta::Factory<Type>::Resolve())));
-    return as<Type>();
+    return *ptr;
 }
 
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
 template<typename Type>
-inline Type *kF::Var::tryCast(void) noexcept
+inline Type *kF::BasicVar<InlineSize, Alignment, Allocator>::tryCast(void) noexcept
 {
-    if (isCastAble<Type>())
+    if (!_type) [[unlikely]]
+        return nullptr;
+    else if (_type.typeID() == typeid(Type)) [[likely]]
         return &as<Type>();
-    return nullptr;
+    // Base subobjects may not be located at the address of the instance
+    return reinterpret_cast<Type *>(_type.upcast(Meta::Factory<Type>::Resolve(), data()));
 }
 
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
 template<typename Type>
-inline const Type *kF::Var::tryCast(void) const noexcept
+inline const Type *kF::BasicVar<InlineSize, Alignment, Allocator>::tryCast(void) const noexcept
 {
-    if (isCastAble<Type>())
-        return &as<Type>();
-    return nullptr;
+    return const_cast<BasicVar *>(this)->tryCast<Type>();
 }
 
-inline kF::Var kF::Var::convertOpaque(const Meta::Type type) const
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+inline kF::BasicVar<InlineSize, Alignment, Allocator> kF::BasicVar<InlineSize, Alignment, Allocator>::convertOpaque(const Meta::Type type) const
 {
-    if (auto conv = _type.findConverter(type); conv)
-        return conv.invoke(*this);
-    else
-        return Var();
+    if (auto conv = _type.findConverter(type); conv) {
+        BasicVar to;
+        to.reserve<ShouldDestructInstance::No>(conv.convertType());
+        conv.invoke(data(), to.data());
+        return to;
+    } else
+        return BasicVar();
 }
 
-inline bool kF::Var::convert(const Meta::Type type)
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+inline bool kF::BasicVar<InlineSize, Alignment, Allocator>::convert(const Meta::Type type)
 {
-    auto conv = _type.findConverter(type);
+    auto toMove = convertOpaque(type);
 
-    if (!conv) [[unlikely]]
+    if (!toMove) [[unlikely]]
         return false;
-    Var toMove = conv.invoke(*this);
     move(toMove);
     return true;
 }
 
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
 template<typename To>
-inline To kF::Var::convertExplicit(void) const
+inline To kF::BasicVar<InlineSize, Alignment, Allocator>::convertExplicit(void) const
 {
     const auto ty = Meta::Factory<To>::Resolve();
     auto conv = type().findConverter(ty);
@@ -233,120 +348,173 @@ inline To kF::Var::convertExplicit(void) const
     return to;
 }
 
-inline bool kF::Var::toBool(void) const
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+inline bool kF::BasicVar<InlineSize, Alignment, Allocator>::toBool(void) const
 {
     kFAssert(type().isBoolConvertible(),
         throw std::logic_error("Var::toBool: Boolean operator is not supported by type '" + TypeToString(type()) + '\''));
     return type().toBool(data());
 }
 
-inline kF::Var kF::Var::operator+(const Var &rhs) const
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+inline kF::BasicVar<InlineSize, Alignment, Allocator> kF::BasicVar<InlineSize, Alignment, Allocator>::operator+(const BasicVar &rhs) const
 {
     kFAssert(type().hasOperator<Meta::BinaryOperator::Addition>(),
         throw std::logic_error("Var::operator+: Addition operator is not supported by type '" + TypeToString(type()) + '\''));
-    return type().invokeOperator<Meta::BinaryOperator::Addition>(data(), rhs);
+    return BasicVar(type().invokeOperator<Meta::BinaryOperator::Addition>(data(), rhs.asVar()));
 }
 
-inline kF::Var kF::Var::operator-(const Var &rhs) const
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+inline kF::BasicVar<InlineSize, Alignment, Allocator> kF::BasicVar<InlineSize, Alignment, Allocator>::operator-(const BasicVar &rhs) const
 {
     kFAssert(type().hasOperator<Meta::BinaryOperator::Substraction>(),
         throw std::logic_error("Var::operator-: Substraction operator is not supported by type '" + TypeToString(type()) + '\''));
-    return type().invokeOperator<Meta::BinaryOperator::Substraction>(data(), rhs);
+    return BasicVar(type().invokeOperator<Meta::BinaryOperator::Substraction>(data(), rhs.asVar()));
 }
 
-inline kF::Var kF::Var::operator*(const Var &rhs) const
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+inline kF::BasicVar<InlineSize, Alignment, Allocator> kF::BasicVar<InlineSize, Alignment, Allocator>::operator*(const BasicVar &rhs) const
 {
     kFAssert(type().hasOperator<Meta::BinaryOperator::Multiplication>(),
         throw std::logic_error("Var::operator*: Multiplication operator is not supported by type '" + TypeToString(type()) + '\''));
-    return type().invokeOperator<Meta::BinaryOperator::Multiplication>(data(), rhs);
+    return BasicVar(type().invokeOperator<Meta::BinaryOperator::Multiplication>(data(), rhs.asVar()));
 }
 
-inline kF::Var kF::Var::operator/(const Var &rhs) const
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+inline kF::BasicVar<InlineSize, Alignment, Allocator> kF::BasicVar<InlineSize, Alignment, Allocator>::operator/(const BasicVar &rhs) const
 {
     kFAssert(type().hasOperator<Meta::BinaryOperator::Division>(),
         throw std::logic_error("Var::operator/: Division operator is not supported by type '" + TypeToString(type()) + '\''));
-    return type().invokeOperator<Meta::BinaryOperator::Division>(data(), rhs);
+    return BasicVar(type().invokeOperator<Meta::BinaryOperator::Division>(data(), rhs.asVar()));
 }
 
-inline kF::Var kF::Var::operator%(const Var &rhs) const
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+inline kF::BasicVar<InlineSize, Alignment, Allocator> kF::BasicVar<InlineSize, Alignment, Allocator>::operator%(const BasicVar &rhs) const
 {
     kFAssert(type().hasOperator<Meta::BinaryOperator::Modulo>(),
         throw std::logic_error("Var::operator%: Modulo operator is not supported by type '" + TypeToString(type()) + '\''));
-    return type().invokeOperator<Meta::BinaryOperator::Modulo>(data(), rhs);
+    return BasicVar(type().invokeOperator<Meta::BinaryOperator::Modulo>(data(), rhs.asVar()));
 }
 
-inline kF::Var &kF::Var::operator+=(const Var &rhs)
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+inline kF::BasicVar<InlineSize, Alignment, Allocator> &kF::BasicVar<InlineSize, Alignment, Allocator>::operator+=(const BasicVar &rhs)
 {
     kFAssert(type().hasOperator<Meta::AssignmentOperator::Addition>(),
         throw std::logic_error("Var::operator+=: Addition operator is not supported by type '" + TypeToString(type()) + '\''));
-    type().invokeOperator<Meta::AssignmentOperator::Addition>(data(), rhs);
+    type().invokeOperator<Meta::AssignmentOperator::Addition>(data(), rhs.asVar());
     return *this;
 }
 
-inline kF::Var &kF::Var::operator-=(const Var &rhs)
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+inline kF::BasicVar<InlineSize, Alignment, Allocator> &kF::BasicVar<InlineSize, Alignment, Allocator>::operator-=(const BasicVar &rhs)
 {
     kFAssert(type().hasOperator<Meta::AssignmentOperator::Substraction>(),
         throw std::logic_error("Var::operator-=: Substraction operator is not supported by type '" + TypeToString(type()) + '\''));
-    type().invokeOperator<Meta::AssignmentOperator::Substraction>(data(), rhs);
+    type().invokeOperator<Meta::AssignmentOperator::Substraction>(data(), rhs.asVar());
     return *this;
 }
 
-inline kF::Var &kF::Var::operator*=(const Var &rhs)
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+inline kF::BasicVar<InlineSize, Alignment, Allocator> &kF::BasicVar<InlineSize, Alignment, Allocator>::operator*=(const BasicVar &rhs)
 {
     kFAssert(type().hasOperator<Meta::AssignmentOperator::Multiplication>(),
         throw std::logic_error("Var::operator*=: Multiplication operator is not supported by type '" + TypeToString(type()) + '\''));
-    type().invokeOperator<Meta::AssignmentOperator::Multiplication>(data(), rhs);
+    type().invokeOperator<Meta::AssignmentOperator::Multiplication>(data(), rhs.asVar());
     return *this;
 }
 
-inline kF::Var &kF::Var::operator/=(const Var &rhs)
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+inline kF::BasicVar<InlineSize, Alignment, Allocator> &kF::BasicVar<InlineSize, Alignment, Allocator>::operator/=(const BasicVar &rhs)
 {
     kFAssert(type().hasOperator<Meta::AssignmentOperator::Division>(),
         throw std::logic_error("Var::operator/=: Division operator is not supported by type '" + TypeToString(type()) + '\''));
-    type().invokeOperator<Meta::AssignmentOperator::Division>(data(), rhs);
+    type().invokeOperator<Meta::AssignmentOperator::Division>(data(), rhs.asVar());
     return *this;
 }
 
-inline kF::Var &kF::Var::operator%=(const Var &rhs)
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+inline kF::BasicVar<InlineSize, Alignment, Allocator> &kF::BasicVar<InlineSize, Alignment, Allocator>::operator%=(const BasicVar &rhs)
 {
     kFAssert(type().hasOperator<Meta::AssignmentOperator::Modulo>(),
         throw std::logic_error("Var::operator%=: Modulo operator is not supported by type '" + TypeToString(type()) + '\''));
-    type().invokeOperator<Meta::AssignmentOperator::Modulo>(data(), rhs);
+    type().invokeOperator<Meta::AssignmentOperator::Modulo>(data(), rhs.asVar());
     return *this;
 }
 
-template<kF::Var::ShouldDestructInstance DestructInstance>
-inline void kF::Var::move(Var &other)
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+template<kF::Meta::Internal::ShouldDestructInstance DestructInstance, std::size_t OtherInlineSize, std::size_t OtherAlignment, typename OtherAllocator>
+inline void kF::BasicVar<InlineSize, Alignment, Allocator>::move(BasicVar<OtherInlineSize, OtherAlignment, OtherAllocator> &other)
 {
-    if (other.isSmallOptimizedValue()) {
-        reserve<UseSmallOptimization::Yes, DestructInstance>(other.type());
-        other.type().moveConstruct(data<UseSmallOptimization::Yes>(), other.data<UseSmallOptimization::Yes>());
+    using OtherStorageType = typename BasicVar<OtherInlineSize, OtherAlignment, OtherAllocator>::StorageType;
+
+    if constexpr (std::is_same_v<BasicVar, BasicVar<OtherInlineSize, OtherAlignment, OtherAllocator>>) {
+        if (other.isSmallOptimizedValue()) {
+            const Meta::Type otherType = other.type();
+            const auto from = other.template data<UseSmallOptimization::Yes>();
+
+            if constexpr (DestructInstance == ShouldDestructInstance::Yes)
+                reserve<DestructInstance>(otherType);
+            else
+                reserve<UseSmallOptimization::Yes, DestructInstance>(otherType);
+            if (otherType.isTriviallyRelocatable()) [[likely]] {
+                if (isSmallOptimizedValue()) [[likely]]
+                    std::memcpy(data<UseSmallOptimization::Yes>(), from, InlineSize);
+                else
+                    std::memcpy(data<UseSmallOptimization::No>(), from, otherType.typeSize());
+                // Copyable values are left as is, others are discarded without destruction
+                if (!otherType.isTriviallyCopyable()) {
+                    other._type = Meta::Type();
+                    other._storageType = StorageType::Undefined;
+                }
+            } else
+                otherType.moveConstruct(data(), from);
+            return;
+        }
     } else {
-        if constexpr (DestructInstance == ShouldDestructInstance::Yes) {
-            destruct<ShouldResetMembers::Yes>();
-            releaseAlloc<DestructInstance>();
+        const Meta::Type otherType = other.type();
+
+        // Values are moved into the inline storage when they fit, otherwise the heap allocation is stolen if allocators match
+        if (other.isSmallOptimizedValue()
+                || (other._storageType == OtherStorageType::Value
+                    && (!std::is_same_v<Allocator, OtherAllocator> || otherType.isSmallOptimized<InlineSize, Alignment>()))) {
+            reserve<DestructInstance>(otherType);
+            otherType.moveConstruct(data(), other.data());
+            return;
         }
-        _type = other._type;
-        _storageType = other._storageType;
-        _capacity = other._capacity;
-        dataRef() = other.dataRef();
-        other._type = Meta::Type();
-        other._storageType = StorageType::Undefined;
-        other._capacity = 0;
     }
+    if constexpr (DestructInstance == ShouldDestructInstance::Yes) {
+        destruct<ShouldResetMembers::Yes>();
+        releaseAlloc<DestructInstance>();
+    }
+    _type = other._type;
+    _storageType = static_cast<StorageType>(other._storageType);
+    _capacity = other._capacity;
+    dataRef() = other.dataRef();
+    other._type = Meta::Type();
+    other._storageType = OtherStorageType::Undefined;
+    other._capacity = 0;
 }
 
-template<kF::Var::ShouldDestructInstance DestructInstance>
-inline void kF::Var::reserve(const Meta::Type type) noexcept_ndebug
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+template<kF::Meta::Internal::ShouldDestructInstance DestructInstance>
+inline void kF::BasicVar<InlineSize, Alignment, Allocator>::reserve(const Meta::Type type) noexcept_ndebug
 {
-    if (type.isSmallOptimized())
+    if (type.isSmallOptimized<InlineSize, Alignment>()) {
+        if constexpr (DestructInstance == ShouldDestructInstance::Yes) {
+            // An owned heap block is kept for the next values rather than released
+            if (_capacity && canReuseAlloc(type.typeSize(), type.typeAlignment())) [[unlikely]] {
+                reserve<UseSmallOptimization::No, DestructInstance>(type);
+                return;
+            }
+        }
         reserve<UseSmallOptimization::Yes, DestructInstance>(type);
-    else
+    } else
         reserve<UseSmallOptimization::No, DestructInstance>(type);
 }
 
-template<kF::Var::UseSmallOptimization IsSmallOptimized, kF::Var::ShouldDestructInstance DestructInstance>
-inline void kF::Var::reserve(const Meta::Type type) noexcept_ndebug
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+template<kF::Meta::Internal::UseSmallOptimization IsSmallOptimized, kF::Meta::Internal::ShouldDestructInstance DestructInstance>
+inline void kF::BasicVar<InlineSize, Alignment, Allocator>::reserve(const Meta::Type type) noexcept_ndebug
 {
     if constexpr (DestructInstance == ShouldDestructInstance::Yes)
         destruct<ShouldResetMembers::No>();
@@ -360,31 +528,108 @@ inline void kF::Var::reserve(const Meta::Type type) noexcept_ndebug
     }
 }
 
-inline void kF::Var::alloc(const std::uint32_t capacity) noexcept_ndebug
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+inline void kF::BasicVar<InlineSize, Alignment, Allocator>::alloc(const std::uint32_t capacity) noexcept_ndebug
 {
-    if (_capacity < capacity) [[likely]] {
-        if (_capacity) [[unlikely]]
-            Core::Utils::AlignedFree(data<UseSmallOptimization::No>());
-        dataRef() = Core::Utils::AlignedAlloc(type().typeSize(), type().typeAlignment());
-        _capacity = capacity;
-        kFAssertFallback(data<UseSmallOptimization::No>() != nullptr,
-            _capacity = 0,
-            throw std::runtime_error("Var::reserve: Memory exhausted")
-        );
+    const auto alignment = type().typeAlignment();
+
+    if (canReuseAlloc(capacity, alignment))
+        return;
+    const auto required = Allocator::Capacity(capacity, alignment);
+    if (_capacity) [[unlikely]]
+        Allocator::Deallocate(data<UseSmallOptimization::No>(), _capacity);
+    dataRef() = Allocator::Allocate(required, alignment);
+    _capacity = required;
+    kFAssertFallback(data<UseSmallOptimization::No>() != nullptr,
+        _capacity = 0,
+        throw std::runtime_error("Var::reserve: Memory exhausted")
+    );
+}
+
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+inline bool kF::BasicVar<InlineSize, Alignment, Allocator>::canReuseAlloc(const std::uint32_t size, const std::size_t alignment) const noexcept
+{
+    return _capacity >= Allocator::Capacity(size, alignment)
+        && !(reinterpret_cast<std::uintptr_t>(_data.ptr) & (alignment - 1u));
+}
+
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+inline void kF::BasicVar<InlineSize, Alignment, Allocator>::reserveCapacity(const std::uint32_t capacity, const std::size_t alignment)
+{
+    if (_storageType == StorageType::ReferenceVolatile || _storageType == StorageType::ReferenceConstant)
+        return;
+    const bool hasValue = _storageType == StorageType::Value || _storageType == StorageType::ValueOptimized;
+    // The stored value is relocated into the new block, which must fit its size and alignment
+    const auto valueCapacity = hasValue ? std::max(capacity, static_cast<std::uint32_t>(_type.typeSize())) : capacity;
+    const auto valueAlignment = hasValue ? std::max(alignment, _type.typeAlignment()) : alignment;
+    if (canReuseAlloc(valueCapacity, valueAlignment))
+        return;
+    const auto required = Allocator::Capacity(valueCapacity, valueAlignment);
+    const auto block = Allocator::Allocate(required, valueAlignment);
+
+    kFAssert(block,
+        throw std::runtime_error("Var::reserveCapacity: Memory exhausted"));
+    if (hasValue) {
+        try {
+            Relocate(_type, block, data());
+        } catch (...) {
+            Allocator::Deallocate(block, required);
+            throw;
+        }
+    }
+    if (_capacity)
+        Allocator::Deallocate(data<UseSmallOptimization::No>(), _capacity);
+    if (_storageType == StorageType::ValueOptimized)
+        _storageType = StorageType::Value;
+    dataRef() = block;
+    _capacity = required;
+}
+
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+inline void kF::BasicVar<InlineSize, Alignment, Allocator>::shrinkToFit(void)
+{
+    if (!_capacity)
+        return;
+    const auto block = data<UseSmallOptimization::No>();
+    if (_storageType != StorageType::Value) {
+        Allocator::Deallocate(block, _capacity);
+        _capacity = 0u;
+        return;
     }
+    if (_type.isSmallOptimized<InlineSize, Alignment>()) {
+        // The value is moved back into the inline storage
+        Relocate(_type, data<UseSmallOptimization::Yes>(), block);
+        Allocator::Deallocate(block, _capacity);
+        _storageType = StorageType::ValueOptimized;
+        _capacity = 0u;
+        return;
+    }
+    const auto alignment = _type.typeAlignment();
+    const auto required = Allocator::Capacity(static_cast<std::uint32_t>(_type.typeSize()), alignment);
+    if (required >= _capacity)
+        return;
+    const auto fitted = Allocator::Allocate(required, alignment);
+    if (!fitted) [[unlikely]]
+        return;
+    Relocate(_type, fitted, block);
+    Allocator::Deallocate(block, _capacity);
+    dataRef() = fitted;
+    _capacity = required;
 }
 
-template<kF::Var::ShouldDestructInstance DestructInstance>
-inline void kF::Var::releaseAlloc(void) noexcept
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+template<kF::Meta::Internal::ShouldDestructInstance DestructInstance>
+inline void kF::BasicVar<InlineSize, Alignment, Allocator>::releaseAlloc(void) noexcept
 {
     if constexpr (DestructInstance == ShouldDestructInstance::Yes) {
         if (_capacity)
-            Core::Utils::AlignedFree(data<UseSmallOptimization::No>());
+            Allocator::Deallocate(data<UseSmallOptimization::No>(), _capacity);
         _capacity = 0;
     }
 }
 
-inline std::string kF::Var::TypeToString(const Meta::Type type) noexcept
+template<std::size_t InlineSize, std::size_t Alignment, typename Allocator>
+inline std::string kF::BasicVar<InlineSize, Alignment, Allocator>::TypeToString(const Meta::Type type) noexcept
 {
     if (!type) [[unlikely]]
         return "null";
@@ -0,0 +1,192 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Var heap allocators
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+#include "Base.hpp"
+
+/**
+ * @brief VarHeapAllocator allocates each heap stored Var value with an aligned allocation
+ *
+ * An allocator is a stateless type whose static functions are used by 'BasicVar' to store values that don't fit inline.
+ * 'Capacity' returns the capacity really reserved for a given size and alignment, it is later given back to 'Deallocate'.
+ * 'IsMonotonic' allocators release their memory all at once, Var never deallocates their blocks.
+ */
+class kF::Meta::VarHeapAllocator
+{
+public:
+    /** @brief Blocks are released one by one */
+    static constexpr bool IsMonotonic = false;
+
+    /** @brief Get the capacity reserved for a value of given size and alignment */
+    [[nodiscard]] static std::uint32_t Capacity(const std::uint32_t size, const std::size_t) noexcept { return size; }
+
+    /** @brief Allocate a memory block of given capacity (returns nullptr on failure) */
+    [[nodiscard]] static void *Allocate(const std::uint32_t capacity, const std::size_t alignment) noexcept
+        { return Core::Utils::AlignedAlloc(capacity, alignment); }
+
+    /** @brief Release a memory block allocated with a given capacity */
+    static void Deallocate(void * const data, const std::uint32_t) noexcept { Core::Utils::AlignedFree(data); }
+};
+
+/**
+ * @brief VarPoolAllocator allocates heap stored Var values from size class pools
+ *
+ * Values up to 'MaxClassSize' bytes are rounded to a power of 2 size class, greater ones use aligned allocations.
+ */
+class kF::Meta::VarPoolAllocator
+{
+public:
+    /** @brief Blocks are released one by one */
+    static constexpr bool IsMonotonic = false;
+
+    /** @brief Get the capacity reserved for a value of given size and alignment */
+    [[nodiscard]] static std::uint32_t Capacity(const std::uint32_t size, const std::size_t alignment) noexcept;
+
+    /** @brief Allocate a memory block of given capacity (returns nullptr on failure) */
+    [[nodiscard]] static void *Allocate(const std::uint32_t capacity, const std::size_t alignment) noexcept;
+
+    /** @brief Release a memory block allocated with a given capacity */
+    static void Deallocate(void * const data, const std::uint32_t capacity) noexcept;
+};
+
+/**
+ * @brief VarMonotonicAllocator allocates heap stored Var values from the monotonic resource of the current thread
+ *
+ * The resource is set by a 'Scope' (typically one per request), every Var using it must be destroyed before the resource.
+ * Blocks are never deallocated and trivially destructible values are released without any call.
+ * Allocations without a resource in scope fail.
+ */
+class kF::Meta::VarMonotonicAllocator
+{
+public:
+    /** @brief Blocks are released with their resource */
+    static constexpr bool IsMonotonic = true;
+
+    /** @brief Set the resource of the current thread for the lifetime of the scope */
+    class Scope
+    {
+    public:
+        /** @brief Set the current resource, the previous one is restored on destruction */
+        Scope(std::pmr::monotonic_buffer_resource &resource) noexcept
+            : _previous(std::exchange(CurrentResource(), &resource)) {}
+
+        /** @brief Restore the previous resource */
+        ~Scope(void) noexcept { CurrentResource() = _previous; }
+
+        /** @brief Scope is not copyable */
+        Scope(const Scope &other) = delete;
+        Scope &operator=(const Scope &other) = delete;
+
+    private:
+        std::pmr::monotonic_buffer_resource *_previous { nullptr };
+    };
+
+    /** @brief Get the resource of the current thread */
+    [[nodiscard]] static std::pmr::monotonic_buffer_resource *&CurrentResource(void) noexcept
+        { static thread_local constinit std::pmr::monotonic_buffer_resource *Resource = nullptr; return Resource; }
+
+    /** @brief Get the capacity reserved for a value of given size and alignment */
+    [[nodiscard]] static std::uint32_t Capacity(const std::uint32_t size, const std::size_t) noexcept { return size; }
+
+    /** @brief Allocate a memory block of given capacity from the current resource (returns nullptr on failure) */
+    [[nodiscard]] static void *Allocate(const std::uint32_t capacity, const std::size_t alignment) noexcept;
+
+    /** @brief Blocks are not deallocated */
+    static void Deallocate(void * const, const std::uint32_t) noexcept {}
+};
+
+/**
+ * @brief VarPool stores free blocks of each size class
+ *
+ * Each thread owns a cache holding a free list per size class, blocks are taken from and released to it without locking.
+ * When a thread cache is empty it takes a batch of blocks from the global pool, when it holds too many blocks it
+ * returns a batch, a single lock is taken for each batch. Chunks of blocks are never released to the system.
+ */
+class kF::Meta::Internal::VarPool
+{
+public:
+    /** @brief Size of the smallest class */
+    static constexpr std::uint32_t MinClassSize = 32u;
+
+    /** @brief Size of the greatest class */
+    static constexpr std::uint32_t MaxClassSize = 1024u;
+
+    /** @brief Number of size classes */
+    static constexpr std::uint32_t ClassCount = std::bit_width(MaxClassSize) - std::bit_width(MinClassSize) + 1u;
+
+    /** @brief Number of blocks transfered between a thread cache and the global pool */
+    static constexpr std::uint32_t BatchSize = 32u;
+
+    /** @brief Maximum number of blocks of a class held by a thread cache */
+    static constexpr std::uint32_t MaxCachedBlocks = BatchSize * 2u;
+
+    /** @brief Get the size class of a given capacity */
+    [[nodiscard]] static std::uint32_t ClassIndex(const std::uint32_t capacity) noexcept
+        { return static_cast<std::uint32_t>(std::bit_width(capacity) - std::bit_width(MinClassSize)); }
+
+    /** @brief Allocate a block of a size class (returns nullptr on failure) */
+    [[nodiscard]] static void *Allocate(const std::uint32_t classIndex) noexcept;
+
+    /** @brief Release a block of a size class into the current thread cache (or into the global pool once the thread exited) */
+    static void Deallocate(void * const data, const std::uint32_t classIndex) noexcept;
+
+private:
+    /** @brief A free block is linked to the next one */
+    struct Block
+    {
+        Block *next;
+    };
+
+    /** @brief A list of free blocks */
+    struct FreeList
+    {
+        Block *head { nullptr };
+        std::uint32_t count { 0u };
+    };
+
+    /** @brief Free lists of a size class shared by every thread */
+    struct SizeClass
+    {
+        std::mutex lock {};
+        std::vector<FreeList> batches {};
+    };
+
+    /** @brief Free lists of the current thread, trivially destructible so it remains usable during thread exit */
+    struct LocalCache
+    {
+        FreeList lists[ClassCount] {};
+        bool registered { false };
+        bool exited { false }; // Set once flushed on thread exit, later blocks bypass the cache
+    };
+
+    /** @brief Returns the blocks of the current thread to the global pool when it exits */
+    struct LocalCacheFlusher
+    {
+        ~LocalCacheFlusher(void) noexcept;
+    };
+
+    /** @brief Get the global size classes, never destroyed as Vars may be released after static destruction */
+    [[nodiscard]] static SizeClass *GetClasses(void) noexcept;
+
+    /** @brief Get the cache of the current thread */
+    [[nodiscard]] static LocalCache &GetLocalCache(void) noexcept
+        { static thread_local constinit LocalCache Cache {}; return Cache; }
+
+    /** @brief Register the current thread cache so its blocks are returned when the thread exits */
+    static void RegisterLocalCache(LocalCache &cache) noexcept;
+
+    /** @brief Fill an empty free list with a batch of the global pool or with a new chunk */
+    [[nodiscard]] static bool Refill(FreeList &list, const std::uint32_t classIndex) noexcept;
+
+    /** @brief Return 'count' blocks of a free list to the global pool */
+    static void Flush(FreeList &list, const std::uint32_t classIndex, const std::uint32_t count) noexcept;
+};
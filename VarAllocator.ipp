@@ -0,0 +1,163 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Var heap allocators
+ */
+
+#include <algorithm>
+
+inline std::uint32_t kF::Meta::VarPoolAllocator::Capacity(const std::uint32_t size, const std::size_t alignment) noexcept
+{
+    const auto capacity = std::bit_ceil(std::max({ size, static_cast<std::uint32_t>(alignment), Internal::VarPool::MinClassSize }));
+
+    // Size classes are aligned on their size, greater values keep their exact size
+    if (capacity <= Internal::VarPool::MaxClassSize) [[likely]]
+        return capacity;
+    else
+        return std::max(size, static_cast<std::uint32_t>(alignment));
+}
+
+inline void *kF::Meta::VarPoolAllocator::Allocate(const std::uint32_t capacity, const std::size_t alignment) noexcept
+{
+    if (capacity <= Internal::VarPool::MaxClassSize) [[likely]]
+        return Internal::VarPool::Allocate(Internal::VarPool::ClassIndex(capacity));
+    else
+        return Core::Utils::AlignedAlloc(capacity, alignment);
+}
+
+inline void kF::Meta::VarPoolAllocator::Deallocate(void * const data, const std::uint32_t capacity) noexcept
+{
+    if (capacity <= Internal::VarPool::MaxClassSize) [[likely]]
+        Internal::VarPool::Deallocate(data, Internal::VarPool::ClassIndex(capacity));
+    else
+        Core::Utils::AlignedFree(data);
+}
+
+inline void *kF::Meta::VarMonotonicAllocator::Allocate(const std::uint32_t capacity, const std::size_t alignment) noexcept
+{
+    const auto resource = CurrentResource();
+
+    if (!resource) [[unlikely]]
+        return nullptr;
+    try {
+        return resource->allocate(capacity, alignment);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+inline void *kF::Meta::Internal::VarPool::Allocate(const std::uint32_t classIndex) noexcept
+{
+    auto &cache = GetLocalCache();
+    auto &list = cache.lists[classIndex];
+
+    if (!list.head) [[unlikely]] {
+        // The cache of an exiting thread isn't refilled as it would never be flushed again
+        if (cache.exited) [[unlikely]] {
+            const auto blockSize = MinClassSize << classIndex;
+            return Core::Utils::AlignedAlloc(blockSize, blockSize);
+        }
+        if (!Refill(list, classIndex)) [[unlikely]]
+            return nullptr;
+    }
+    const auto block = list.head;
+    list.head = block->next;
+    --list.count;
+    return block;
+}
+
+inline void kF::Meta::Internal::VarPool::Deallocate(void * const data, const std::uint32_t classIndex) noexcept
+{
+    auto &cache = GetLocalCache();
+    auto &list = cache.lists[classIndex];
+    const auto block = reinterpret_cast<Block *>(data);
+
+    // The cache of an exiting thread was already flushed, the block is returned to the global pool on its own
+    if (cache.exited) [[unlikely]] {
+        FreeList single { block, 1u };
+        block->next = nullptr;
+        Flush(single, classIndex, 1u);
+        return;
+    }
+    if (!cache.registered) [[unlikely]]
+        RegisterLocalCache(cache);
+    block->next = list.head;
+    list.head = block;
+    if (++list.count > MaxCachedBlocks) [[unlikely]]
+        Flush(list, classIndex, BatchSize);
+}
+
+inline kF::Meta::Internal::VarPool::SizeClass *kF::Meta::Internal::VarPool::GetClasses(void) noexcept
+{
+    static const auto Classes = new SizeClass[ClassCount];
+
+    return Classes;
+}
+
+inline void kF::Meta::Internal::VarPool::RegisterLocalCache(LocalCache &cache) noexcept
+{
+    static thread_local LocalCacheFlusher Flusher {};
+
+    cache.registered = true;
+}
+
+inline kF::Meta::Internal::VarPool::LocalCacheFlusher::~LocalCacheFlusher(void) noexcept
+{
+    auto &cache = GetLocalCache();
+
+    for (auto classIndex = 0u; classIndex != ClassCount; ++classIndex) {
+        auto &list = cache.lists[classIndex];
+        if (list.count)
+            Flush(list, classIndex, list.count);
+    }
+    cache.exited = true;
+}
+
+inline bool kF::Meta::Internal::VarPool::Refill(FreeList &list, const std::uint32_t classIndex) noexcept
+{
+    auto &sizeClass = GetClasses()[classIndex];
+
+    RegisterLocalCache(GetLocalCache());
+    {
+        std::lock_guard<std::mutex> guard(sizeClass.lock);
+        if (!sizeClass.batches.empty()) {
+            list = sizeClass.batches.back();
+            sizeClass.batches.pop_back();
+            return true;
+        }
+    }
+
+    // The global pool is empty, a new chunk is carved into a batch of blocks aligned on their size
+    const auto blockSize = MinClassSize << classIndex;
+    const auto chunk = reinterpret_cast<std::byte *>(Core::Utils::AlignedAlloc(blockSize * BatchSize, blockSize));
+    if (!chunk) [[unlikely]]
+        return false;
+    for (auto i = BatchSize; i != 0u; --i) {
+        const auto block = reinterpret_cast<Block *>(chunk + (i - 1u) * blockSize);
+        block->next = list.head;
+        list.head = block;
+    }
+    list.count = BatchSize;
+    return true;
+}
+
+inline void kF::Meta::Internal::VarPool::Flush(FreeList &list, const std::uint32_t classIndex, const std::uint32_t count) noexcept
+{
+    auto &sizeClass = GetClasses()[classIndex];
+    FreeList batch { list.head, count };
+    auto last = list.head;
+
+    for (auto i = 1u; i != count; ++i)
+        last = last->next;
+    const auto remaining = last->next;
+    last->next = nullptr;
+    try {
+        std::lock_guard<std::mutex> guard(sizeClass.lock);
+        sizeClass.batches.push_back(batch);
+    } catch (...) {
+        // The global pool could not grow, blocks stay in the thread cache
+        last->next = remaining;
+        return;
+    }
+    list.head = remaining;
+    list.count -= count;
+}